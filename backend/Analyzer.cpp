@@ -0,0 +1,207 @@
+#include "Analyzer.hpp"
+#include "Fen.hpp"
+#include "MappedFile.hpp"
+#include "Search.hpp"
+#include "TranspositionTable.hpp"
+
+#include <atomic>
+#include <bit>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+	// JSON string with quotes, backslashes and control characters escaped
+	std::string jsonString(std::string_view str) {
+		std::string res = "\"";
+
+		for (char c : str) {
+			if (c == '"' or c == '\\')
+				res += '\\', res += c;
+			else if (static_cast<unsigned char>(c) < 0x20) {
+				char escaped[8];
+				std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+				res += escaped;
+			}
+			else
+				res += c;
+		}
+
+		return res + '"';
+	}
+
+	std::string jsonScore(Score score) {
+		if (score > Score::infinity - static_cast<int16_t>(max_depth))
+			return "{\"mate\":" + std::to_string((Score::infinity - score.toInt() + 1) / 2) + '}';
+		else if (score < -Score::infinity + static_cast<int16_t>(max_depth))
+			return "{\"mate\":" + std::to_string(-((score.toInt() + Score::infinity + 1) / 2)) + '}';
+
+		return "{\"cp\":" + std::to_string(score.toInt()) + '}';
+	}
+
+	// first operand of an EPD operation as a number, zero when there is none
+	double operandNumber(const EpdRecord& record, std::string_view opcode) {
+		const auto* operands = record.find(opcode);
+
+		if (!operands or operands->empty())
+			return 0;
+
+		char* end;
+		const double value = std::strtod(operands->front().c_str(), &end);
+
+		return *end or value < 0 ? 0 : value;
+	}
+
+	INLINE bool isBlankOrComment(std::string_view line) {
+		const size_t first = line.find_first_not_of(" \t");
+		return first == std::string_view::npos or line[first] == '#';
+	}
+
+} // namespace
+
+bool Analyzer::run(const std::string& epd_path, const std::string& out_path, const Settings& settings) {
+	_stats = Stats();
+
+	MappedFile epd;
+
+	if (!epd.open(epd_path))
+		return false;
+
+	std::ofstream out(out_path, std::ios::trunc);
+
+	if (!out)
+		return false;
+
+	const std::vector<std::string_view> lines = Epd::splitLines(epd.view());
+	const unsigned threads = std::max(settings.threads, 1U);
+
+	// Table sizes have to be powers of two. Entries of a shared table are written without locks,
+	// a torn entry is possible then, but its move is verified before it's used as usual.
+	std::deque<TranspositionTable> tables(settings.shared_hash ? 1 : threads);
+
+	for (auto& tt : tables) {
+		tt.resize(std::bit_floor(std::max<size_t>(settings.hash_mb, 1)));
+		tt.reset();
+	}
+
+	std::atomic<size_t> next_line = 0;
+	std::vector<Stats> worker_stats(threads);
+
+	// results wait until all the lines before them are written, so the output keeps order of the input
+	std::mutex out_mutex;
+	std::vector<std::string> results(lines.size());
+	std::vector<bool> finished(lines.size());
+	size_t written = 0;
+
+	auto work = [&](unsigned worker_idx) {
+		const auto search = std::make_unique<Search>(tables[settings.shared_hash ? 0 : worker_idx]);
+		search->setPrintInfo(false);
+
+		Position pos;
+		Game game;
+		EpdRecord record;
+		Stats& stats = worker_stats[worker_idx];
+
+		for (size_t idx; (idx = next_line++) < lines.size(); ) {
+			std::string result;
+
+			if (Epd::parse(lines[idx], record, pos))
+				result = analyze(record, idx + 1, *search, pos, game, settings, stats);
+
+			stats.skipped += result.empty() and !isBlankOrComment(lines[idx]);
+
+			std::lock_guard<std::mutex> lock(out_mutex);
+
+			results[idx] = std::move(result);
+			finished[idx] = true;
+
+			for (; written < lines.size() and finished[written]; written++) {
+				if (!results[written].empty())
+					out << results[written] << '\n';
+
+				results[written] = std::string();
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+
+	for (unsigned i = 0; i < threads; i++)
+		workers.emplace_back(work, i);
+
+	for (auto& worker : workers)
+		worker.join();
+
+	for (const auto& stats : worker_stats) {
+		_stats.positions += stats.positions;
+		_stats.skipped += stats.skipped;
+		_stats.nodes += stats.nodes;
+	}
+
+	return static_cast<bool>(out.flush());
+}
+
+std::string Analyzer::analyze(const EpdRecord& record, size_t line_no, Search& search, Position& pos, Game& game,
+	const Settings& settings, Stats& stats) const {
+	SearchLimits limits;
+	limits.depth = settings.depth;
+	limits.nodes = settings.nodes;
+	limits.movetime = settings.movetime;
+
+	if (const double acd = operandNumber(record, "acd"); acd >= 1)
+		limits.depth = static_cast<unsigned>(acd);
+
+	if (const double acn = operandNumber(record, "acn"); acn >= 1)
+		limits.nodes = static_cast<uint64_t>(acn);
+
+	if (const double acs = operandNumber(record, "acs"); acs > 0)
+		limits.movetime = std::max(static_cast<unsigned>(acs * 1000), 1U);
+
+	if (!limits.depth and !limits.nodes and !limits.movetime)
+		limits.depth = default_depth;
+
+	limits.depth = limits.depth ? std::min(limits.depth, max_depth - 1) : max_depth - 1;
+
+	// positions are independent, nothing of the previous one is kept apart from the hash table
+	game.clear();
+	search.clearCounterMoves();
+
+	const std::string fen = Fen::toStr(pos);
+
+	Timer timer;
+	timer.go();
+
+	const uint64_t nodes = search.bestMove(pos, game, limits);
+
+	timer.stop();
+
+	const SearchResults& results = search.getResults();
+
+	stats.positions++;
+	stats.nodes += nodes;
+
+	std::string json = "{\"line\":" + std::to_string(line_no);
+
+	if (const auto* id = record.find("id"); id and !id->empty())
+		json += ",\"id\":" + jsonString(id->front());
+
+	json += ",\"fen\":" + jsonString(fen)
+		+ ",\"bestmove\":\"" + results.best_move.toStr() + '"'
+		+ ",\"score\":" + jsonScore(results.score_cp)
+		+ ",\"depth\":" + std::to_string(results.depth)
+		+ ",\"seldepth\":" + std::to_string(results.seldepth)
+		+ ",\"nodes\":" + std::to_string(nodes)
+		+ ",\"time\":" + std::to_string(timer.duration())
+		+ ",\"pv\":[";
+
+	for (size_t i = 0; i < results.pv.count(); i++) {
+		json += i ? ",\"" : "\"";
+		json += results.pv.getMove(i).toStr();
+		json += '"';
+	}
+
+	return json + "]}";
+}
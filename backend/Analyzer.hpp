@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Epd.hpp"
+
+#include <vector>
+
+class Search;
+class Position;
+class Game;
+
+/*
+	Batch analysis of EPD or FEN positions. Positions are handed out to worker threads one by one,
+	each worker has its own Search, Position and Game, and either a hash table of its own or one
+	shared by all of them. Results are written as JSON lines in order of the input file:
+
+	{"line":1,"id":"WAC.001","fen":"...","bestmove":"g3g6","score":{"mate":2},"depth":12,"seldepth":9,
+	 "nodes":48214,"time":35,"pv":["g3g6","f7g6","e2g4"]}
+
+	Depth, node and time limits are given for each position. EPD operations acd (depth), acn (nodes)
+	and acs (seconds) override them for a single position.
+*/
+class Analyzer {
+public:
+	struct Settings {
+		unsigned depth = 0,
+				 movetime = 0;
+		uint64_t nodes = 0;
+		unsigned threads = 1;
+		// one hash table shared by all the workers, otherwise a table for each one
+		bool shared_hash = true;
+		size_t hash_mb = 16;
+	};
+
+	struct Stats {
+		uint64_t positions = 0,
+				 skipped = 0,
+				 nodes = 0;
+	};
+
+	// returns false when input file can't be read or output file can't be written
+	bool run(const std::string& epd_path, const std::string& out_path, const Settings& settings);
+
+	INLINE const Stats& getStats() const { return _stats; }
+private:
+	// JSON line with the result of the position of the record, already set by Epd::parse
+	std::string analyze(const EpdRecord& record, size_t line_no, Search& search, Position& pos, Game& game,
+		const Settings& settings, Stats& stats) const;
+
+	// depth of the positions without any limit
+	static constexpr unsigned default_depth = 10;
+
+	Stats _stats;
+};
@@ -4,28 +4,32 @@
 #include "BitBoard.hpp"
 #include "Magic.hpp"
 
-// static and pre-computed attack masks for double-sided pawns, knights as also kings.
+// static and pre-computed attack masks for double-sided pawns, knights as also kings,
+// generated at compile time.
 struct StaticAttackTables {
-	StaticAttackTables() { init(); }
+	constexpr StaticAttackTables()
+		: for_pawns{}, for_knights{}, for_kings{} {
+		init();
+	}
 
-	inline BitBoard whitePawnAttacksOnFly(Square sq) {
+	static constexpr BitBoard whitePawnAttacksOnFly(Square sq) {
 		BitBoard bit(sq);
 		return noEaOne(bit) | noWeOne(bit);
 	}
 
-	inline BitBoard blackPawnAttacksOnFly(Square sq) {
+	static constexpr BitBoard blackPawnAttacksOnFly(Square sq) {
 		BitBoard bit(sq);
 		return soEaOne(bit) | soWeOne(bit);
 	}
 
-	inline BitBoard knightAttacksOnFly(Square sq) {
+	static constexpr BitBoard knightAttacksOnFly(Square sq) {
 		BitBoard bit(sq);
 		return noNoEa(bit) | noEaEa(bit) | soEaEa(bit)
 			| soSoEa(bit) | soSoWe(bit) | soWeWe(bit)
 			| noWeWe(bit) | noNoWe(bit);
 	}
 
-	inline BitBoard kingAttacksOnFly(Square sq) {
+	static constexpr BitBoard kingAttacksOnFly(Square sq) {
 		BitBoard bit(sq);
 		return nortOne(bit) | noEaOne(bit) | eastOne(bit)
 			| soEaOne(bit) | soutOne(bit) | soWeOne(bit)
@@ -33,7 +37,7 @@ struct StaticAttackTables {
 	}
 
 	// generate attack masks for each square
-	void init() {
+	constexpr void init() {
 		for (enumColor col : { WHITE, BLACK })
 			for (int sq = 0; sq < 64; sq++)
 				for_pawns[col][sq] = col == WHITE ? whitePawnAttacksOnFly(sq)
@@ -49,7 +53,7 @@ struct StaticAttackTables {
 	std::array<BitBoard, 64> for_knights, for_kings;
 };
 
-inline const StaticAttackTables attack_tables;
+inline constexpr StaticAttackTables attack_tables;
 
 namespace {
 
@@ -69,19 +73,19 @@ namespace {
 	}
 
 	BitBoard nortRay(Square sq) {
-		return 0x0101010101010100Ui64 << sq;
+		return 0x0101010101010100ULL << sq;
 	}
 
 	BitBoard soutRay(Square sq) {
-		return 0x0080808080808080Ui64 >> (sq ^ 63);
+		return 0x0080808080808080ULL >> (sq ^ 63);
 	}
 
 	BitBoard westRay(Square sq) {
-		return (1Ui64 << sq) - (1Ui64 << (sq & 56));
+		return (1ULL << sq) - (1ULL << (sq & 56));
 	}
 
 	BitBoard eastRay(Square sq) {
-		return 2 * ((1Ui64 << (sq | 7)) - (1Ui64 << sq));
+		return 2 * ((1ULL << (sq | 7)) - (1ULL << sq));
 	}
 
 	BitBoard noEaRay(Square sq) {
@@ -2,8 +2,7 @@
 
 #include "Common.hpp"
 #include "Square.hpp"
-
-#include <cstdint>
+#include "Intrinsics.hpp"
 
 template <typename T>
 constexpr inline uint64_t U64(T val) {
@@ -22,10 +21,10 @@ public:
 		: _board(raw_init) {}
 
 	inline constexpr BitBoard(Square sq)
-		: _board(1Ui64 << sq) {}
+		: _board(1ULL << sq) {}
 
 	inline constexpr BitBoard(Square::enumSquare sq)
-		: _board(1Ui64 << sq) {}
+		: _board(1ULL << sq) {}
 
 	INLINE constexpr operator uint64_t() const {
 		return _board;
@@ -94,7 +93,7 @@ public:
 	template <int Shift>
 	INLINE BitBoard genShift() const {
 		if constexpr (Shift < 0) return _board >> (-Shift);
-		return _board << Shift;
+		else return _board << Shift;
 	}
 
 	template <int Shift>
@@ -109,9 +108,17 @@ public:
 	
 	void set(uint64_t bb);
 
-	int popCount() const;
-	int bitScanForward() const;
-	int bitScanReverse() const;
+	INLINE int popCount() const {
+		return Intrinsics::popCount64(_board);
+	}
+
+	INLINE int bitScanForward() const {
+		return Intrinsics::bitScanForward64(_board);
+	}
+
+	INLINE int bitScanReverse() const {
+		return Intrinsics::bitScanReverse64(_board);
+	}
 
 	// bit scan forward but with LS1B reset
 	INLINE int dropForward() {
@@ -122,17 +129,17 @@ public:
 
 	INLINE void popBit(Square sq) {
 		assert(sq.isValid() and sq.isNotNull());
-		_board &= ~(1Ui64 << sq);
+		_board &= ~(1ULL << sq);
 	}
 
 	INLINE void setBit(int shift) {
 		assert(shift < 64);
-		_board |= (1Ui64 << shift);
+		_board |= (1ULL << shift);
 	}
 
 	INLINE bool getBit(int shift) const {
 		assert(shift < 64);
-		return _board & (1Ui64 << shift);
+		return _board & (1ULL << shift);
 	}
 
 	INLINE bool isEmptySq(Square sq) const {
@@ -152,7 +159,7 @@ public:
 	template <int Rank>
 	static INLINE constexpr BitBoard rank() {
 		static_assert(1 <= Rank and Rank <= 8, "Invalid rank");
-		return BitBoard(0xffUi64 << ((Rank - 1) * 8));
+		return BitBoard(0xffULL << ((Rank - 1) * 8));
 	}
 
 	template <File File_>
@@ -161,12 +168,12 @@ public:
 	}
 
 	// crucial uint64_t constants
-	static constexpr uint64_t universe = 0xffffffffffffffffUi64,
-							  empty = 0Ui64,
-							  a_file = 0x0101010101010101Ui64,
-							  b_file = 0x0202020202020202Ui64,
-							  g_file = 0x4040404040404040Ui64,
-							  h_file = 0x8080808080808080Ui64,
+	static constexpr uint64_t universe = 0xffffffffffffffffULL,
+							  empty = 0ULL,
+							  a_file = 0x0101010101010101ULL,
+							  b_file = 0x0202020202020202ULL,
+							  g_file = 0x4040404040404040ULL,
+							  h_file = 0x8080808080808080ULL,
 							  not_a_file = ~a_file,
 						      not_b_file = ~b_file,
 						      not_g_file = ~g_file,
@@ -177,17 +184,48 @@ private:
 	uint64_t _board;
 };
 
-// Rectangular lookup for in-between routines
+// Rectangular lookup for in-between routines, generated at compile time
 struct RectangularTable {
-	RectangularTable() { init(); }
-
-	BitBoard inBetweenOnFly(Square org, Square dst);
-	void init();
+	constexpr RectangularTable()
+		: table{} {
+		for (int i = 0; i < 64; i++)
+			for (int j = 0; j < 64; j++)
+				table[i][j] = inBetweenOnFly(i, j);
+	}
+
+	static constexpr BitBoard inBetweenOnFly(int org, int dst) {
+		constexpr auto abs = [](int x) { return x < 0 ? -x : x; };
+
+		uint64_t res = BitBoard::empty;
+
+		const int sq_min = org < dst ? org : dst,
+			sq_max = org < dst ? dst : org;
+
+		// loop approach for each case: through file, rank and diagonal
+		if (org % 8 == dst % 8) {
+			for (int i = 0; i <= abs(dst / 8 - org / 8); i++) {
+				res |= 1ULL << ((sq_min / 8 + i) * 8 + org % 8);
+			}
+		}
+		else if (org / 8 == dst / 8) {
+			for (int i = 0; i <= abs(dst % 8 - org % 8); i++) {
+				res |= 1ULL << (sq_min + i);
+			}
+		}
+		else if (abs(org % 8 - dst % 8) == abs(org / 8 - dst / 8)) {
+			for (int i = 0; i <= abs(org % 8 - dst % 8); i++) {
+				res |= 1ULL << (sq_min + i * (sq_min % 8 < sq_max % 8 ? 9 : 7));
+			}
+		}
+
+		// if there is no straight path between org and dst, return universe
+		return res == BitBoard::empty ? BitBoard::universe : res;
+	}
 
 	std::array<std::array<BitBoard, 64>, 64> table;
 };
 
-inline const RectangularTable rectangular;
+inline constexpr RectangularTable rectangular;
 
 // General setwise operations on BitBoard wrapper class *
 
@@ -195,70 +233,90 @@ namespace {
 
 	// one step only and shifting routines *
 
-	INLINE BitBoard nortOne(BitBoard bb) {
+	INLINE constexpr BitBoard nortOne(BitBoard bb) {
 		return bb << 8;
 	}
 
-	INLINE BitBoard soutOne(BitBoard bb) {
+	INLINE constexpr BitBoard soutOne(BitBoard bb) {
 		return bb >> 8;
 	}
 
-	INLINE BitBoard westOne(BitBoard bb) {
+	INLINE constexpr BitBoard westOne(BitBoard bb) {
 		return (bb >> 1) & BitBoard::not_h_file;
 	}
 
-	INLINE BitBoard eastOne(BitBoard bb) {
+	INLINE constexpr BitBoard eastOne(BitBoard bb) {
 		return (bb << 1) & BitBoard::not_a_file;
 	}
 
-	INLINE BitBoard noEaOne(BitBoard bb) {
+	INLINE constexpr BitBoard noEaOne(BitBoard bb) {
 		return (bb << 9) & BitBoard::not_a_file;
 	}
 
-	INLINE BitBoard soEaOne(BitBoard bb) {
+	INLINE constexpr BitBoard soEaOne(BitBoard bb) {
 		return (bb >> 7) & BitBoard::not_a_file;
 	}
 
-	INLINE BitBoard soWeOne(BitBoard bb) {
+	INLINE constexpr BitBoard soWeOne(BitBoard bb) {
 		return (bb >> 9) & BitBoard::not_h_file;
 	}
 
-	INLINE BitBoard noWeOne(BitBoard bb) {
+	INLINE constexpr BitBoard noWeOne(BitBoard bb) {
 		return (bb << 7) & BitBoard::not_h_file;
 	}
 
-	INLINE BitBoard noNoEa(BitBoard bb) {
+	INLINE constexpr BitBoard noNoEa(BitBoard bb) {
 		return (bb << 17) & BitBoard::not_a_file;
 	}
 
-	INLINE BitBoard noEaEa(BitBoard bb) {
+	INLINE constexpr BitBoard noEaEa(BitBoard bb) {
 		return (bb << 10) & BitBoard::not_ab_file;
 	}
 
-	INLINE BitBoard soEaEa(BitBoard bb) {
+	INLINE constexpr BitBoard soEaEa(BitBoard bb) {
 		return (bb >> 6) & BitBoard::not_ab_file;
 	}
 
-	INLINE BitBoard soSoEa(BitBoard bb) {
+	INLINE constexpr BitBoard soSoEa(BitBoard bb) {
 		return (bb >> 15) & BitBoard::not_a_file;
 	}
 
-	INLINE BitBoard soSoWe(BitBoard bb) {
+	INLINE constexpr BitBoard soSoWe(BitBoard bb) {
 		return (bb >> 17) & BitBoard::not_h_file;
 	}
 
-	INLINE BitBoard soWeWe(BitBoard bb) {
+	INLINE constexpr BitBoard soWeWe(BitBoard bb) {
 		return (bb >> 10) & BitBoard::not_gh_file;
 	}
 
-	INLINE BitBoard noWeWe(BitBoard bb) {
+	INLINE constexpr BitBoard noWeWe(BitBoard bb) {
 		return (bb << 6) & BitBoard::not_gh_file;
 	}
 
-	INLINE BitBoard noNoWe(BitBoard bb) {
+	INLINE constexpr BitBoard noNoWe(BitBoard bb) {
 		return (bb << 15) & BitBoard::not_h_file;
 	}
 
+	// fill routines - bits smeared over the whole file in given direction *
+
+	INLINE constexpr BitBoard nortFill(BitBoard bb) {
+		bb |= bb << 8;
+		bb |= bb << 16;
+		bb |= bb << 32;
+		return bb;
+	}
+
+	INLINE constexpr BitBoard soutFill(BitBoard bb) {
+		bb |= bb >> 8;
+		bb |= bb >> 16;
+		bb |= bb >> 32;
+		return bb;
+	}
+
+	INLINE constexpr BitBoard fileFill(BitBoard bb) {
+		return nortFill(bb) | soutFill(bb);
+	}
+
 	INLINE BitBoard inBetween(Square org, Square dst) {
 		assert(org.isValid() and org.isNotNull() and dst.isValid() and dst.isNotNull());
 		return rectangular.table[org][dst];
@@ -0,0 +1,245 @@
+#include "Bitbase.hpp"
+#include "Hash.hpp"
+
+#include <deque>
+#include <filesystem>
+#include <fstream>
+
+namespace {
+
+	// "LBB" and format version
+	static constexpr std::array<char, 4> file_magic = { 'L', 'B', 'B', 1 };
+	static constexpr size_t code_size = 8;
+
+	std::deque<Bitbase::Table> tables;
+
+} // namespace
+
+Bitbase::Table::Table(const std::string& code)
+	: _code(code) {
+	std::array<std::array<int, 6>, 2> counts = {};
+	enumColor side = WHITE;
+
+	for (char c : code) {
+		if (c == 'v') {
+			side = BLACK;
+			continue;
+		}
+
+		const auto piece_t = Piece::typeFromChar(c);
+
+		_pieces[_piece_count++] = { side, piece_t };
+		counts[side][piece_t]++;
+	}
+
+	// first side king on 32 squares of a-d files, other pieces anywhere
+	_size = 2 * 32;
+
+	for (int i = 1; i < _piece_count; i++)
+		_size *= 64;
+
+	_bits.assign((_size + 63) / 64, 0);
+
+	for (bool swapped : { false, true }) {
+		uint64_t key = 0;
+
+		for (enumColor col : { WHITE, BLACK }) {
+			for (auto piece_t : Piece::piece_list) {
+				for (int i = 0; i < counts[col != swapped][piece_t]; i++)
+					key ^= zobrist_keys.piece[col][piece_t][i];
+			}
+		}
+
+		(swapped ? _key2 : _key) = key;
+	}
+}
+
+size_t Bitbase::Table::index(const Position& pos, enumColor first) const {
+	std::array<int, max_pieces> squares;
+
+	// first side becomes white
+	const int flip = first == BLACK ? 56 : 0;
+
+	for (int i = 0; i < _piece_count; i++) {
+		const auto [side, piece_t] = _pieces[i];
+		uint64_t bb = pos.getPiecesBySide(side == WHITE ? first : !first, piece_t);
+
+		// identical pieces take their squares in turn
+		for (int j = 0; j < i; j++) {
+			if (_pieces[j] == _pieces[i])
+				bb &= bb - 1;
+		}
+
+		squares[i] = Intrinsics::bitScanForward64(bb) ^ flip;
+	}
+
+	// first side king goes to a-d files
+	const int mirror = (squares[0] & 7) > 3 ? 7 : 0,
+			  king_sq = squares[0] ^ mirror;
+
+	size_t idx = (pos.getTurn() != first) * 32 + (king_sq >> 3) * 4 + (king_sq & 7);
+
+	for (int i = 1; i < _piece_count; i++)
+		idx = idx * 64 + (squares[i] ^ mirror);
+
+	return idx;
+}
+
+bool Bitbase::Table::setPosition(size_t idx, Position& pos) const {
+	std::array<std::array<BitBoard, 6>, 2> pieces = {};
+	uint64_t occupied = 0;
+
+	for (int i = _piece_count - 1; i >= 0; i--) {
+		int sq;
+
+		if (i) {
+			sq = idx % 64;
+			idx /= 64;
+		}
+		else
+			sq = (idx % 32) / 4 * 8 + idx % 4;
+
+		const auto [side, piece_t] = _pieces[i];
+		const int rank = sq >> 3;
+
+		if (occupied & (1ULL << sq) or (piece_t == Piece::PAWN and (rank == 0 or rank == 7)))
+			return false;
+
+		occupied |= 1ULL << sq;
+		pieces[side][piece_t] |= 1ULL << sq;
+	}
+
+	const int white_ksq = Intrinsics::bitScanForward64(pieces[WHITE][Piece::KING]),
+			  black_ksq = Intrinsics::bitScanForward64(pieces[BLACK][Piece::KING]);
+
+	// kings can't stand next to each other
+	if (std::abs((white_ksq & 7) - (black_ksq & 7)) <= 1 and std::abs((white_ksq >> 3) - (black_ksq >> 3)) <= 1)
+		return false;
+
+	pos.setByPieces(pieces, idx / 32 ? BLACK : WHITE);
+	return true;
+}
+
+bool Bitbase::Table::save(const std::string& path) const {
+	std::array<char, code_size> code = {};
+	std::copy(_code.begin(), _code.end(), code.begin());
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+	file.write(file_magic.data(), file_magic.size());
+	file.write(code.data(), code.size());
+	// little endian words, as they are in memory
+	file.write(reinterpret_cast<const char*>(_bits.data()), static_cast<std::streamsize>(_bits.size() * sizeof(uint64_t)));
+
+	return static_cast<bool>(file);
+}
+
+bool Bitbase::Table::saveSource(const std::string& path) const {
+	std::string name;
+
+	for (char c : _code) {
+		if (c != 'v')
+			name += static_cast<char>(tolower(c));
+	}
+
+	std::ofstream file(path, std::ios::trunc);
+
+	file << "// generated with \"makebitbase " << _code << ' ' << std::filesystem::path(path).filename().string() << "\"\n"
+		<< "#include \"Bitbase.hpp\"\n\n"
+		<< "const std::array<uint64_t, " << _bits.size() << "> Bitbase::" << name << "_bits = {\n";
+
+	char word[24];
+
+	for (size_t i = 0; i < _bits.size(); i++) {
+		std::snprintf(word, sizeof(word), "0x%016llxULL,", static_cast<unsigned long long>(_bits[i]));
+		file << (i % 4 ? " " : "\t") << word << (i % 4 == 3 ? "\n" : "");
+	}
+
+	file << (_bits.size() % 4 ? "\n" : "") << "};\n";
+
+	return static_cast<bool>(file);
+}
+
+bool Bitbase::Table::load(const std::string& path) {
+	std::ifstream file(path, std::ios::binary);
+
+	std::array<char, 4> magic;
+	std::array<char, code_size> code;
+
+	file.read(magic.data(), magic.size());
+	file.read(code.data(), code.size());
+
+	if (!file or magic != file_magic)
+		return false;
+
+	const std::string file_code(code.data(), strnlen(code.data(), code.size()));
+
+	if (!isValidCode(file_code))
+		return false;
+
+	*this = Table(file_code);
+	file.read(reinterpret_cast<char*>(_bits.data()), static_cast<std::streamsize>(_bits.size() * sizeof(uint64_t)));
+
+	// nothing may follow the bits
+	return file and file.peek() == std::ifstream::traits_type::eof();
+}
+
+bool Bitbase::Table::isValidCode(const std::string& code) {
+	const size_t separator = code.find('v');
+
+	if (separator == std::string::npos or code.find('v', separator + 1) != std::string::npos
+		or code.size() - 1 > static_cast<size_t>(max_pieces))
+		return false;
+
+	const std::string_view view = code;
+
+	for (const std::string_view side : { view.substr(0, separator), view.substr(separator + 1) }) {
+		if (side.empty() or side[0] != 'K' or side.find_first_not_of("KQRBNP") != std::string::npos
+			or side.find('K', 1) != std::string::npos)
+			return false;
+	}
+
+	return true;
+}
+
+const Bitbase::Table& Bitbase::kpk() {
+	static const Table table = [] {
+		Table res("KPvK");
+		std::copy(kpk_bits.begin(), kpk_bits.end(), res.bits().begin());
+		return res;
+	}();
+
+	return table;
+}
+
+size_t Bitbase::init(const std::string& path) {
+	tables.clear();
+
+	std::error_code error;
+
+	if (path.empty() or path == "<empty>" or !std::filesystem::is_directory(path, error))
+		return 0;
+
+	for (const auto& entry : std::filesystem::directory_iterator(path, error)) {
+		if (entry.path().extension() != ".bb")
+			continue;
+
+		Table table("KvK");
+
+		if (table.load(entry.path().string()))
+			tables.push_back(std::move(table));
+	}
+
+	return tables.size();
+}
+
+const Bitbase::Table* Bitbase::find(uint64_t material_key, enumColor& first) {
+	for (const auto& table : tables) {
+		if (table.key() == material_key or table.key2() == material_key) {
+			first = table.key() == material_key ? WHITE : BLACK;
+			return &table;
+		}
+	}
+
+	return nullptr;
+}
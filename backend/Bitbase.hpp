@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Position.hpp"
+
+#include <vector>
+
+/*
+	Win/draw bitbases of endgames with up to 4 pieces, made by BitbaseGenerator. A bitbase keeps
+	one bit for every placement of the pieces and side to move - whether the first side of the material
+	wins by force. Positions are stored with the first side as white and its king on a-d files, other
+	positions are flipped into that form. Castling rights and en passant squares aren't a part of a bitbase.
+	KPK bitbase is compiled into the engine, other ones are loaded from files.
+*/
+namespace Bitbase {
+
+	static constexpr int max_pieces = 4;
+
+	class Table {
+	public:
+		// material code like KRvKP, the first side is the one whose wins are stored
+		Table(const std::string& code);
+
+		// index of a position, where the first side of the material has given color
+		size_t index(const Position& pos, enumColor first) const;
+
+		// sets position of the index, returns false when pieces overlap, kings are adjacent or pawns stand on the last ranks
+		bool setPosition(size_t idx, Position& pos) const;
+
+		INLINE bool isWin(size_t idx) const { return _bits[idx / 64] >> (idx % 64) & 1; }
+		INLINE void setWin(size_t idx) { _bits[idx / 64] |= 1ULL << (idx % 64); }
+
+		INLINE const std::string& code() const { return _code; }
+		INLINE size_t size() const { return _size; }
+		INLINE std::vector<uint64_t>& bits() { return _bits; }
+		INLINE const std::vector<uint64_t>& bits() const { return _bits; }
+
+		// material keys with the first side white and black
+		INLINE uint64_t key() const { return _key; }
+		INLINE uint64_t key2() const { return _key2; }
+
+		bool save(const std::string& path) const;
+		// C++ definition of the bits, to be compiled into the engine
+		bool saveSource(const std::string& path) const;
+		bool load(const std::string& path);
+
+		// code is a valid material of up to max_pieces pieces, with one king on each side
+		static bool isValidCode(const std::string& code);
+	private:
+		std::string _code;
+		// pieces in order of the code, first side pieces are marked with WHITE
+		std::array<std::pair<enumColor, Piece::enumType>, max_pieces> _pieces = {};
+		int _piece_count = 0;
+		size_t _size = 0;
+		uint64_t _key = 0, _key2 = 0;
+		std::vector<uint64_t> _bits;
+	};
+
+	// bits of KPK bitbase, in KPKBitbase.cpp generated with "makebitbase KPvK KPKBitbase.cpp"
+	extern const std::array<uint64_t, 4096> kpk_bits;
+
+	const Table& kpk();
+
+	// loads all the bitbase files (*.bb) of a directory, empty path or "<empty>" drops the loaded ones.
+	// Returns number of bitbases loaded.
+	size_t init(const std::string& path);
+
+	// loaded bitbase of the material of a position and color of its first side, nullptr when there is none
+	const Table* find(uint64_t material_key, enumColor& first);
+
+} // namespace Bitbase
@@ -0,0 +1,187 @@
+#include "BitbaseGenerator.hpp"
+#include "MoveGen.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace {
+
+	// pieces of both sides without kings, e.g. { "RP", "" } of KRPvK
+	using Sides = std::array<std::string, 2>;
+
+	Sides splitCode(const std::string& code) {
+		const size_t separator = code.find('v');
+		return { code.substr(1, separator - 1), code.substr(separator + 2) };
+	}
+
+	// pieces of a side go from the strongest, so every material has one code
+	std::string joinCode(Sides sides) {
+		static constexpr std::string_view order = "QRBNP";
+
+		for (auto& side : sides) {
+			std::sort(side.begin(), side.end(), [](char a, char b) { return order.find(a) < order.find(b); });
+		}
+
+		return 'K' + sides[0] + "vK" + sides[1];
+	}
+
+	// runs func(first, last, thread_idx) over index range split among threads
+	template <typename Func>
+	void parallelFor(size_t size, unsigned threads, Func func) {
+		std::vector<std::thread> workers;
+		const size_t chunk = (size + threads - 1) / threads;
+
+		for (unsigned i = 0; i < threads; i++)
+			workers.emplace_back(func, std::min(size, i * chunk), std::min(size, (i + 1) * chunk), i);
+
+		for (auto& worker : workers)
+			worker.join();
+	}
+
+} // namespace
+
+bool BitbaseGenerator::generate(const std::string& code, const Settings& settings) {
+	_stats = Stats();
+	_tables.clear();
+
+	if (!Bitbase::Table::isValidCode(code))
+		return false;
+
+	makeTable(joinCode(splitCode(code)), settings);
+	return true;
+}
+
+const Bitbase::Table& BitbaseGenerator::makeTable(const std::string& code, const Settings& settings) {
+	for (const auto& table : _tables) {
+		if (table.code() == code)
+			return table;
+	}
+
+	const Sides sides = splitCode(code);
+
+	// materials reached by captures and promotions, the first side with bare king can't win
+	for (size_t side = 0; side < 2; side++) {
+		for (size_t i = 0; i < sides[side].size(); i++) {
+			Sides changed = sides;
+			changed[side].erase(i, 1);
+
+			if (!changed[0].empty())
+				makeTable(joinCode(changed), settings);
+
+			if (sides[side][i] != 'P')
+				continue;
+
+			for (char promo_t : { 'Q', 'R', 'B', 'N' }) {
+				changed = sides;
+				changed[side][i] = promo_t;
+				makeTable(joinCode(changed), settings);
+			}
+		}
+	}
+
+	// deque keeps references to the tables generated before
+	_tables.emplace_back(code);
+	generateTable(_tables.back(), settings);
+
+	return _tables.back();
+}
+
+void BitbaseGenerator::generateTable(Bitbase::Table& table, const Settings& settings) {
+	const unsigned threads = std::max(settings.threads, 1U);
+
+	std::vector<enumState> states(table.size(), UNKNOWN);
+	std::vector<uint64_t> changed(threads),
+						  positions(threads);
+
+	for (unsigned pass = 0; ; pass++) {
+		std::fill(changed.begin(), changed.end(), 0);
+
+		// States are updated in place, so results of a pass are used by the rest of it right away.
+		// They only go from unknown to known, so a thread reading an older state just finds a win later.
+		parallelFor(table.size(), threads, [&](size_t first, size_t last, unsigned thread_idx) {
+			Position pos;
+
+			for (size_t idx = first; idx < last; idx++) {
+				if (states[idx] != UNKNOWN)
+					continue;
+
+				std::atomic_ref<enumState> state(states[idx]);
+
+				// the side which isn't to move can't be in check
+				if (!table.setPosition(idx, pos) or pos.isInCheck(!pos.getTurn())) {
+					state.store(NO_WIN, std::memory_order_relaxed);
+					continue;
+				}
+
+				positions[thread_idx] += !pass;
+
+				const enumState new_state = evaluate(pos, table, states);
+
+				if (new_state != UNKNOWN) {
+					state.store(new_state, std::memory_order_relaxed);
+					changed[thread_idx]++;
+				}
+			}
+		});
+
+		_stats.passes++;
+
+		if (!std::accumulate(changed.begin(), changed.end(), uint64_t(0)))
+			break;
+	}
+
+	for (size_t idx = 0; idx < table.size(); idx++) {
+		if (states[idx] == WIN) {
+			table.setWin(idx);
+			_stats.wins++;
+		}
+	}
+
+	_stats.positions += std::accumulate(positions.begin(), positions.end(), uint64_t(0));
+	_stats.tables++;
+}
+
+BitbaseGenerator::enumState BitbaseGenerator::evaluate(Position& pos, const Bitbase::Table& table,
+	std::vector<enumState>& states) const {
+	MoveList move_list;
+	MoveGen::generatePseudoLegalMoves<MoveGen::ALL>(pos, move_list);
+
+	const bool first_to_move = pos.getTurn() == WHITE;
+	bool can_move = false;
+
+	for (size_t i = 0; i < move_list.count(); i++) {
+		Move move = move_list.getMove(i);
+		Position::IrreversibleState state;
+
+		if (!pos.make(move, state)) {
+			pos.unmake(move, state);
+			continue;
+		}
+
+		can_move = true;
+
+		const bool win = move.isCapture() or move.isPromotion() ? isSubtableWin(pos)
+			: std::atomic_ref<enumState>(states[table.index(pos, WHITE)]).load(std::memory_order_relaxed) == WIN;
+
+		pos.unmake(move, state);
+
+		// the first side needs one winning move, the second side one move that doesn't lose
+		if (win == first_to_move)
+			return first_to_move ? WIN : UNKNOWN;
+	}
+
+	if (!can_move)
+		return !first_to_move and pos.isInCheck(BLACK) ? WIN : NO_WIN;
+
+	return first_to_move ? UNKNOWN : WIN;
+}
+
+bool BitbaseGenerator::isSubtableWin(const Position& pos) const {
+	for (const auto& table : _tables) {
+		if (table.key() == pos.getMaterialKey())
+			return table.isWin(table.index(pos, WHITE));
+	}
+
+	// the first side is left with bare king
+	return false;
+}
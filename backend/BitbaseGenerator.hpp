@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Bitbase.hpp"
+
+#include <deque>
+
+/*
+	Generates win/draw bitbases by retrograde analysis over all the positions of a material.
+	Mates of the second side are wins first, then in every pass a position with the first side to move
+	is won when one of its moves leads to a won position, and a position with the second side to move
+	when all of its moves do. Passes go on until nothing changes, positions left are draws or losses.
+	Captures and promotions lead to other materials, their bitbases are generated beforehand.
+	Moves are generated and made on Position, positions of a pass are split among threads.
+*/
+class BitbaseGenerator {
+public:
+	struct Settings {
+		unsigned threads = 1;
+	};
+
+	struct Stats {
+		uint64_t positions = 0,
+				 wins = 0;
+		unsigned passes = 0,
+				 tables = 0;
+	};
+
+	// returns false when the material code isn't valid
+	bool generate(const std::string& code, const Settings& settings);
+
+	// bitbase of the material given to generate
+	INLINE const Bitbase::Table& getTable() const { return _tables.back(); }
+	INLINE const Stats& getStats() const { return _stats; }
+private:
+	enum enumState : uint8_t {
+		UNKNOWN, WIN, NO_WIN
+	};
+
+	// generated bitbase of given code, generating it with its subtables first when it isn't there yet
+	const Bitbase::Table& makeTable(const std::string& code, const Settings& settings);
+
+	void generateTable(Bitbase::Table& table, const Settings& settings);
+
+	// state of a position with the first side as white
+	enumState evaluate(Position& pos, const Bitbase::Table& table, std::vector<enumState>& states) const;
+
+	// result of a position reached by a capture or a promotion
+	bool isSubtableWin(const Position& pos) const;
+
+	std::deque<Bitbase::Table> _tables;
+	Stats _stats;
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Position.hpp"
+#include "Move.hpp"
+#include "MappedFile.hpp"
+
+#include <random>
+
+// random keys of Polyglot hashing scheme, shared by book probing and book building
+struct PolyglotKeys {
+	// 12 piece kinds on 64 squares, 4 castling rights, 8 en passant files and white to move
+	static constexpr int castle_offset = 768,
+						 ep_offset = 772,
+						 turn_offset = 780;
+
+	static const std::array<uint64_t, 781> random;
+};
+
+/*
+	Opening book in Polyglot format: a file of 16-byte big-endian entries (key, move, weight, learn), 
+	sorted by key. The file is memory mapped read-only once, when it's opened, so probing 
+	is a binary search over mapped memory - no file reads and no allocations per probe.
+	Moves with the same key are picked randomly, proportionally to their weights.
+*/
+class Book {
+public:
+	struct Entry {
+		uint64_t key;
+		uint16_t move;
+		uint16_t weight;
+		uint32_t learn;
+	};
+
+	Book();
+	// fixed seed of move picks, so they repeat between runs
+	explicit Book(uint64_t seed);
+
+	// returns false when the file can't be mapped
+	bool open(const std::string& path);
+	void close();
+
+	INLINE bool isOpen() const { return _data != nullptr; }
+	INLINE size_t entriesCount() const { return _entries; }
+
+	// returns null move when the position isn't in the book
+	Move probe(const Position& pos);
+
+	static uint64_t polyglotKey(const Position& pos);
+
+	// Polyglot move format: target, origin and promotion piece, castling encoded as king captures own rook
+	static uint16_t encodeMove(Move move);
+	// returns null move when there is no such legal move in the position
+	static Move decodeMove(const Position& pos, uint16_t book_move);
+
+	static constexpr size_t entry_size = 16;
+private:
+	Entry readEntry(size_t idx) const;
+	uint64_t readKey(size_t idx) const;
+
+	MappedFile _file;
+
+	const uint8_t* _data = nullptr;
+	size_t _entries = 0;
+
+	std::mt19937 _rng;
+};
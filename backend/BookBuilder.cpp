@@ -0,0 +1,232 @@
+#include "BookBuilder.hpp"
+#include "Fen.hpp"
+#include "MappedFile.hpp"
+
+#include <fstream>
+#include <thread>
+
+namespace {
+
+	template <typename T>
+	INLINE uint8_t* writeBigEndian(uint8_t* data, T value) {
+		for (size_t i = sizeof(T); i--; value = static_cast<T>(value >> 8))
+			data[i] = static_cast<uint8_t>(value);
+
+		return data + sizeof(T);
+	}
+
+} // namespace
+
+bool BookBuilder::build(const std::string& pgn_path, const std::string& book_path, const Settings& settings) {
+	_stats = Stats();
+
+	MappedFile pgn;
+
+	if (!pgn.open(pgn_path))
+		return false;
+
+	const auto chunks = PgnReader::split(pgn.view(), std::max(settings.threads, 1U));
+
+	std::vector<MoveTable> tables(chunks.size());
+	std::vector<Stats> chunk_stats(chunks.size());
+	std::vector<std::thread> threads;
+
+	for (size_t i = 0; i < chunks.size(); i++) {
+		threads.emplace_back(&BookBuilder::readChunk, this, chunks[i], settings.depth,
+			std::ref(tables[i]), std::ref(chunk_stats[i]));
+	}
+
+	for (auto& thread : threads)
+		thread.join();
+
+	for (const auto& stats : chunk_stats) {
+		_stats.games += stats.games;
+		_stats.skipped_games += stats.skipped_games;
+	}
+
+	const std::vector<Book::Entry> entries = makeEntries(tables, settings.min_games);
+
+	_stats.entries = entries.size();
+
+	for (size_t i = 0; i < entries.size(); i++)
+		_stats.positions += !i or entries[i].key != entries[i - 1].key;
+
+	return write(book_path, entries);
+}
+
+void BookBuilder::readChunk(std::string_view chunk, unsigned depth, MoveTable& table, Stats& stats) const {
+	PgnReader reader(chunk);
+	PgnGame game;
+
+	const Position start_pos;
+	Position pos;
+
+	while (reader.next(game)) {
+		// book weights come from game results
+		if (game.result == PgnGame::UNKNOWN or (!game.fen.empty() and !Fen::parse(game.fen, pos))) {
+			stats.skipped_games++;
+			continue;
+		}
+
+		stats.games++;
+
+		if (game.fen.empty())
+			pos = start_pos;
+
+		size_t idx = 0;
+
+		for (unsigned ply = 0; ply < depth; ply++) {
+			const std::string_view token = Pgn::nextToken(game.movetext, idx);
+
+			if (token.empty())
+				break;
+
+			Move move = Pgn::parseSan(pos, token);
+
+			// rest of the game can't be followed
+			if (move.isNull())
+				break;
+
+			MoveStats& move_stats = table.get(pos.getZobristKey(), Book::encodeMove(move));
+
+			// Polyglot key is computed only once for each position
+			if (!move_stats.games)
+				move_stats.polyglot_key = Book::polyglotKey(pos);
+
+			move_stats.games++;
+
+			if (game.result == PgnGame::DRAW)
+				move_stats.draws++;
+			else if ((game.result == PgnGame::WHITE_WIN) == (pos.getTurn() == WHITE))
+				move_stats.wins++;
+
+			Position::IrreversibleState state;
+			pos.make(move, state);
+		}
+	}
+}
+
+std::vector<Book::Entry> BookBuilder::makeEntries(const std::vector<MoveTable>& tables, unsigned min_games) const {
+	struct Record {
+		uint64_t key;
+		uint16_t move;
+		uint32_t games, weight;
+	};
+
+	std::vector<Record> records;
+	size_t count = 0;
+
+	for (const auto& table : tables)
+		count += table.count();
+
+	records.reserve(count);
+
+	for (const auto& table : tables) {
+		for (const auto& move_stats : table.slots()) {
+			if (move_stats.games) {
+				records.push_back(Record{ move_stats.polyglot_key, move_stats.move, 
+					move_stats.games, 2 * move_stats.wins + move_stats.draws });
+			}
+		}
+	}
+
+	// the same position may come from different tables, or have several Zobrist keys
+	// with one Polyglot key, e.g. when they differ only in en passant square nobody can capture on
+	std::sort(records.begin(), records.end(), [](const Record& a, const Record& b) {
+		return a.key != b.key ? a.key < b.key : a.move < b.move;
+	});
+
+	size_t merged_count = 0;
+
+	for (size_t i = 0; i < records.size(); i++) {
+		if (merged_count and records[merged_count - 1].key == records[i].key
+			and records[merged_count - 1].move == records[i].move) {
+			records[merged_count - 1].games += records[i].games;
+			records[merged_count - 1].weight += records[i].weight;
+		}
+		else
+			records[merged_count++] = records[i];
+	}
+
+	records.resize(merged_count);
+
+	// rare moves and moves which have only lost
+	std::erase_if(records, [min_games](const Record& r) { return r.games < min_games or !r.weight; });
+
+	std::vector<Book::Entry> entries;
+	entries.reserve(records.size());
+
+	for (size_t first = 0, last; first < records.size(); first = last) {
+		uint32_t max_weight = 0;
+
+		for (last = first; last < records.size() and records[last].key == records[first].key; last++)
+			max_weight = std::max(max_weight, records[last].weight);
+
+		// weights have to fit in 16 bits, proportions between moves of the position are kept
+		for (size_t i = first; i < last; i++) {
+			const uint32_t weight = max_weight > UINT16_MAX ?
+				std::max<uint32_t>(static_cast<uint64_t>(records[i].weight) * UINT16_MAX / max_weight, 1) : records[i].weight;
+
+			entries.push_back(Book::Entry{ records[i].key, records[i].move, static_cast<uint16_t>(weight), 0 });
+		}
+
+		// best moves first
+		std::stable_sort(entries.end() - (last - first), entries.end(), [](const Book::Entry& a, const Book::Entry& b) {
+			return a.weight > b.weight;
+		});
+	}
+
+	return entries;
+}
+
+BookBuilder::MoveStats& BookBuilder::MoveTable::get(uint64_t key, uint16_t move) {
+	if (2 * (_count + 1) > _slots.size())
+		grow();
+
+	size_t idx = index(key, move);
+
+	for (; _slots[idx].games; idx = (idx + 1) & (_slots.size() - 1)) {
+		if (_slots[idx].key == key and _slots[idx].move == move)
+			return _slots[idx];
+	}
+
+	// slot of a new move, counted in advance
+	_count++;
+	_slots[idx].key = key;
+	_slots[idx].move = move;
+
+	return _slots[idx];
+}
+
+void BookBuilder::MoveTable::grow() {
+	std::vector<MoveStats> old_slots(2 * _slots.size());
+	old_slots.swap(_slots);
+
+	for (const auto& move_stats : old_slots) {
+		if (!move_stats.games)
+			continue;
+
+		size_t idx = index(move_stats.key, move_stats.move);
+
+		for (; _slots[idx].games; idx = (idx + 1) & (_slots.size() - 1));
+
+		_slots[idx] = move_stats;
+	}
+}
+
+bool BookBuilder::write(const std::string& path, const std::vector<Book::Entry>& entries) {
+	std::vector<uint8_t> data(entries.size() * Book::entry_size);
+	uint8_t* out = data.data();
+
+	for (const auto& entry : entries) {
+		out = writeBigEndian(out, entry.key);
+		out = writeBigEndian(out, entry.move);
+		out = writeBigEndian(out, entry.weight);
+		out = writeBigEndian(out, entry.learn);
+	}
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+	return static_cast<bool>(file);
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Book.hpp"
+#include "Pgn.hpp"
+
+#include <vector>
+
+/*
+	Builds Polyglot book out of PGN games. The file is mapped and cut into chunks at game
+	boundaries, each chunk is read by its own thread into its own table of played moves,
+	keyed by Zobrist key of the position and the move. Only first plies of a game are decoded,
+	the rest of movetext is skipped untouched. Tables are merged at the end, moves played
+	in too few games are dropped and the rest is written sorted by Polyglot key,
+	with weight 2 * wins + draws from the point of view of the side that played the move.
+	Keys are the standard ones of PolyglotKeys, so any Polyglot reader can use the book.
+*/
+class BookBuilder {
+public:
+	struct Settings {
+		// plies of a game added to the book
+		unsigned depth = 20;
+		// minimal number of games a move has been played in
+		unsigned min_games = 3;
+		unsigned threads = 1;
+	};
+
+	struct Stats {
+		uint64_t games = 0,
+				 skipped_games = 0,
+				 positions = 0,
+				 entries = 0;
+	};
+
+	// returns false when PGN file can't be read or book file can't be written
+	bool build(const std::string& pgn_path, const std::string& book_path, const Settings& settings);
+
+	INLINE const Stats& getStats() const { return _stats; }
+private:
+	struct MoveStats {
+		uint64_t key, polyglot_key;
+		uint16_t move;
+		uint32_t games, wins, draws;
+	};
+
+	/*
+		Open addressing table of moves played in positions, keyed by Zobrist key and the move.
+		Most of the positions deeper in games are unique, so the table gets big quickly -
+		it's a flat array with linear probing, doubled when it's half full.
+	*/
+	class MoveTable {
+	public:
+		MoveTable()
+			: _slots(initial_size) {}
+
+		// slot of the move, empty one has zero games
+		MoveStats& get(uint64_t key, uint16_t move);
+
+		INLINE const std::vector<MoveStats>& slots() const { return _slots; }
+		INLINE size_t count() const { return _count; }
+	private:
+		void grow();
+
+		INLINE size_t index(uint64_t key, uint16_t move) const {
+			// Zobrist keys are random already
+			return (key ^ (move * 0x9e3779b97f4a7c15ULL)) & (_slots.size() - 1);
+		}
+
+		static constexpr size_t initial_size = 1 << 16;
+
+		std::vector<MoveStats> _slots;
+		size_t _count = 0;
+	};
+
+	void readChunk(std::string_view chunk, unsigned depth, MoveTable& table, Stats& stats) const;
+
+	// sorted book entries of moves from all the tables
+	std::vector<Book::Entry> makeEntries(const std::vector<MoveTable>& tables, unsigned min_games) const;
+
+	static bool write(const std::string& path, const std::vector<Book::Entry>& entries);
+
+	Stats _stats;
+};
@@ -2,8 +2,13 @@
 
 #include <iostream>
 #include <string>
-#include <intrin.h>
 #include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <algorithm>
 #include <type_traits>
 #include <array>
 #include <string_view>
@@ -13,6 +18,10 @@
 #define INLINE __forceinline 
 #define _FORCEINLINE __forceinline
 #define _LAMBDA_FORCEINLINE [[msvc::forceinline]] 
+#elif defined(__GNUC__)
+#define INLINE inline __attribute__((always_inline))
+#define _FORCEINLINE inline __attribute__((always_inline))
+#define _LAMBDA_FORCEINLINE __attribute__((always_inline))
 #else
 #define INLINE inline
 #define _FORCEINLINE inline
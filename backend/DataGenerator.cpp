@@ -0,0 +1,199 @@
+#include "DataGenerator.hpp"
+#include "Book.hpp"
+#include "MoveGen.hpp"
+#include "Search.hpp"
+#include "TranspositionTable.hpp"
+
+#include <atomic>
+#include <bit>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+
+struct DataGenerator::Worker {
+	Worker(const Settings& settings, unsigned idx)
+		: book(settings.seed + idx), rng(settings.seed + idx) {
+		tt.resize(std::bit_floor(std::max<size_t>(settings.hash_mb, 1)));
+		tt.reset();
+
+		search = std::make_unique<Search>(tt);
+		search->setPrintInfo(false);
+	}
+
+	TranspositionTable tt;
+	std::unique_ptr<Search> search;
+	Book book;
+	std::mt19937_64 rng;
+
+	Position pos;
+	Game game;
+	uint64_t nodes = 0;
+};
+
+bool DataGenerator::generate(const std::string& path, const Settings& settings) {
+	_stats = Stats();
+
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+
+	if (!out)
+		return false;
+
+	const unsigned threads = std::max(settings.threads, 1U);
+	std::vector<std::unique_ptr<Worker>> workers;
+
+	for (unsigned i = 0; i < threads; i++) {
+		workers.push_back(std::make_unique<Worker>(settings, i));
+
+		if (!settings.book.empty() and !workers.back()->book.open(settings.book))
+			return false;
+	}
+
+	std::atomic<bool> stop = false;
+	std::mutex out_mutex;
+
+	auto work = [&](Worker& worker) {
+		std::vector<TrainingEntry> entries;
+
+		while (!stop) {
+			entries.clear();
+
+			if (!playGame(worker, settings, entries))
+				continue;
+
+			std::lock_guard<std::mutex> lock(out_mutex);
+
+			if (stop)
+				break;
+
+			// the last game is cut to the number of positions asked for
+			const size_t count = std::min<uint64_t>(entries.size(), settings.positions - _stats.positions);
+
+			out.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(count * sizeof(TrainingEntry)));
+
+			_stats.games++;
+			_stats.positions += count;
+			stop = _stats.positions >= settings.positions or !out;
+		}
+	};
+
+	std::vector<std::thread> threads_list;
+
+	for (auto& worker : workers)
+		threads_list.emplace_back(work, std::ref(*worker));
+
+	for (auto& thread : threads_list)
+		thread.join();
+
+	for (const auto& worker : workers)
+		_stats.nodes += worker->nodes;
+
+	return static_cast<bool>(out.flush());
+}
+
+bool DataGenerator::playOpening(Worker& worker, const Settings& settings) const {
+	Position& pos = worker.pos;
+	Position::IrreversibleState state;
+
+	pos.setStartingPos();
+	worker.game.clear();
+
+	// book lines may be long, but not longer than a quarter of the game
+	for (unsigned ply = 0; ply < max_game_moves / 4; ply++) {
+		MoveList legal_moves;
+		MoveGen::generateLegalMoves(pos, legal_moves);
+
+		if (!legal_moves.count())
+			return false;
+
+		Move move = Move::null;
+
+		if (worker.book.isOpen())
+			move = worker.book.probe(pos);
+		else if (ply < settings.random_plies)
+			move = legal_moves.getMove(std::uniform_int_distribution<size_t>(0, legal_moves.count() - 1)(worker.rng));
+
+		if (move.isNull())
+			return true;
+
+		worker.game.recordInfo(pos.getZobristKey(), move);
+		pos.make(move, state);
+	}
+
+	return true;
+}
+
+bool DataGenerator::playGame(Worker& worker, const Settings& settings, std::vector<TrainingEntry>& entries) const {
+	if (!playOpening(worker, settings))
+		return false;
+
+	Position& pos = worker.pos;
+	Game& game = worker.game;
+	Search& search = *worker.search;
+
+	search.clearCounterMoves();
+
+	SearchLimits limits;
+	limits.depth = max_depth - 1;
+	limits.nodes = std::max<uint64_t>(settings.nodes, 1);
+
+	const size_t first_entry = entries.size();
+	TrainingEntry::enumResult result = TrainingEntry::DRAW;
+
+	// plies in a row with the position scored as a draw, as won by white and as won by black
+	unsigned draw_plies = 0, white_plies = 0, black_plies = 0;
+
+	for (unsigned ply = 0; ; ply++) {
+		const enumColor turn = pos.getTurn();
+
+		MoveList legal_moves;
+		MoveGen::generateLegalMoves(pos, legal_moves);
+
+		if (!legal_moves.count()) {
+			result = !pos.isInCheck(turn) ? TrainingEntry::DRAW : turn == WHITE ? TrainingEntry::BLACK_WIN : TrainingEntry::WHITE_WIN;
+			break;
+		}
+
+		if (pos.halfmoveClock() >= 100 or pos.isInsufficientMaterial()
+			or game.isThreefold(pos.getZobristKey(), pos.halfmoveClock()) or game.currentHalfCount() + 1 >= max_game_moves) {
+			result = TrainingEntry::DRAW;
+			break;
+		}
+
+		worker.nodes += search.bestMove(pos, game, limits);
+
+		const SearchResults& results = search.getResults();
+		Move move = results.best_move;
+
+		const int score = results.score_cp.toInt(),
+				  white_score = turn == WHITE ? score : -score;
+		const bool mate_score = std::abs(score) >= Score::infinity - static_cast<int>(max_depth);
+
+		if (!ply and std::abs(score) > settings.opening_score)
+			return false;
+
+		if (ply >= settings.skip_plies and !mate_score and !pos.isInCheck(turn) and move.isQuiet() and !move.isPromotion())
+			entries.push_back(TrainingEntry::pack(pos, static_cast<int16_t>(white_score), TrainingEntry::DRAW));
+
+		draw_plies = std::abs(score) <= settings.draw_score ? draw_plies + 1 : 0;
+		white_plies = white_score > settings.win_score ? white_plies + 1 : 0;
+		black_plies = white_score < -settings.win_score ? black_plies + 1 : 0;
+
+		if (draw_plies >= settings.draw_plies or white_plies >= settings.win_plies or black_plies >= settings.win_plies) {
+			result = draw_plies >= settings.draw_plies ? TrainingEntry::DRAW
+				   : white_plies >= settings.win_plies ? TrainingEntry::WHITE_WIN : TrainingEntry::BLACK_WIN;
+			break;
+		}
+
+		Position::IrreversibleState state;
+
+		game.recordInfo(pos.getZobristKey(), move);
+		pos.make(move, state);
+	}
+
+	for (size_t i = first_entry; i < entries.size(); i++)
+		entries[i].result = result;
+
+	return true;
+}
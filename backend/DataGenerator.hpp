@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Common.hpp"
+#include "TrainingData.hpp"
+
+#include <vector>
+
+/*
+	Self-play generator of training data. Games start with random moves or moves of a Polyglot book,
+	then every move is searched with a fixed number of nodes. Only quiet positions are kept - not in
+	check, with a quiet best move and without a mate score. When the game ends, its result labels
+	all the kept positions and they are written as TrainingEntry records. Games are played by
+	several threads at once, each with its own search and hash table.
+
+	Games end with mate, stalemate, 50-move rule, threefold repetition or insufficient material.
+	Long games are cut short: a draw when both sides have scored the position within draw_score
+	for draw_plies plies, a win when the side to move has been scored above win_score for win_plies plies.
+*/
+class DataGenerator {
+public:
+	struct Settings {
+		uint64_t positions = 1000000;
+		unsigned threads = 1;
+		uint64_t nodes = 5000;
+		// random moves of an opening, when there is no book
+		unsigned random_plies = 8;
+		// Polyglot book of openings, moves are taken while the position is in the book
+		std::string book;
+		size_t hash_mb = 16;
+		uint64_t seed = 1;
+		// openings scored out of this margin by the first search are dropped
+		int opening_score = 400;
+		int draw_score = 10,
+			win_score = 1500;
+		unsigned draw_plies = 16,
+				 win_plies = 8;
+		// plies searched after the random or book opening, which aren't written yet
+		// (with the defaults the first 16 plies of a game are left out)
+		unsigned skip_plies = 8;
+	};
+
+	struct Stats {
+		uint64_t games = 0,
+				 positions = 0,
+				 nodes = 0;
+	};
+
+	// returns false when the book can't be opened or the output can't be written
+	bool generate(const std::string& path, const Settings& settings);
+
+	INLINE const Stats& getStats() const { return _stats; }
+private:
+	struct Worker;
+
+	// plays a game from a new opening, kept positions are appended to the entries
+	// and labelled with the result. Returns false when the opening has been dropped.
+	bool playGame(Worker& worker, const Settings& settings, std::vector<TrainingEntry>& entries) const;
+
+	// opening played into the position of the worker, false when the game has ended on the way
+	bool playOpening(Worker& worker, const Settings& settings) const;
+
+	Stats _stats;
+};
@@ -0,0 +1,84 @@
+#include "Endgame.hpp"
+#include "Bitbase.hpp"
+
+namespace {
+
+	INLINE int distance(Square sq1, Square sq2) {
+		return std::max(std::abs(sq1.getFile() - sq2.getFile()), std::abs(sq1.getRank() - sq2.getRank()));
+	}
+
+	// 0 in the center, 3 on the edge
+	INLINE int centerDistance(Square sq) {
+		return std::max(std::abs(2 * sq.getFile() - 7), std::abs(2 * sq.getRank() - 7)) / 2;
+	}
+
+	INLINE int nonPawnMaterial(const Position& pos, enumColor side) {
+		return 300 * pos.getKnightsBySide(side).popCount() + 300 * pos.getBishopsBySide(side).popCount()
+			+ 500 * pos.getRooksBySide(side).popCount() + 900 * pos.getQueensBySide(side).popCount();
+	}
+
+} // namespace
+
+namespace Endgame {
+
+	Score KXK(const Position& pos, enumColor strong) {
+		const Square strong_ksq = pos.getKingSquare(strong),
+					 weak_ksq = pos.getKingSquare(!strong);
+
+		// drive the lone king to the edge, with own king coming closer
+		return known_win + nonPawnMaterial(pos, strong) + 100 * pos.getPawnsBySide(strong).popCount()
+			+ 40 * centerDistance(weak_ksq) + 10 * (7 - distance(strong_ksq, weak_ksq));
+	}
+
+	Score KBNK(const Position& pos, enumColor strong) {
+		static constexpr uint64_t dark_squares = 0xaa55aa55aa55aa55ULL;
+
+		const Square strong_ksq = pos.getKingSquare(strong),
+					 weak_ksq = pos.getKingSquare(!strong);
+		const bool dark_bishop = pos.getBishopsBySide(strong) & dark_squares;
+
+		// mate is possible only in a corner of the bishop color
+		const int corner_dist = dark_bishop ? std::min(distance(weak_ksq, Square::a1), distance(weak_ksq, Square::h8))
+											: std::min(distance(weak_ksq, Square::a8), distance(weak_ksq, Square::h1));
+
+		return known_win + 600 + 20 * centerDistance(weak_ksq) + 30 * (7 - corner_dist)
+			+ 10 * (7 - distance(strong_ksq, weak_ksq));
+	}
+
+	Score KPK(const Position& pos, enumColor strong) {
+		const Bitbase::Table& kpk = Bitbase::kpk();
+
+		if (!kpk.isWin(kpk.index(pos, strong)))
+			return Score::draw;
+
+		const Square pawn_sq = pos.getPawnsBySide(strong).bitScanForward();
+		const int rank = strong == WHITE ? pawn_sq.getRank() : 7 - pawn_sq.getRank();
+
+		// push the pawn, with own king escorting it
+		return known_win + 100 + 10 * rank - 10 * distance(pos.getKingSquare(strong), pawn_sq);
+	}
+
+	Score bitbaseWin(const Position& pos, enumColor strong) {
+		enumColor first;
+		const Bitbase::Table* table = Bitbase::find(pos.getMaterialKey(), first);
+
+		// bitbases were reloaded after the material entry was filled
+		if (!table)
+			return Score::undef;
+
+		// the same material on both sides, either of them may win
+		if (table->key() == table->key2() and table->isWin(table->index(pos, !strong)))
+			return -bitbaseWin(pos, !strong);
+
+		if (!table->isWin(table->index(pos, strong)))
+			return Score::draw;
+
+		const Square strong_ksq = pos.getKingSquare(strong),
+					 weak_ksq = pos.getKingSquare(!strong);
+
+		return known_win + nonPawnMaterial(pos, strong) - nonPawnMaterial(pos, !strong)
+			+ 100 * pos.getPawnsBySide(strong).popCount() + 20 * centerDistance(weak_ksq)
+			+ 10 * (7 - distance(strong_ksq, weak_ksq));
+	}
+
+} // namespace Endgame
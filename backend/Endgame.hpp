@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Position.hpp"
+#include "Score.hpp"
+
+/*
+	Evaluation functions of endgames, where generic evaluation doesn't know the winning plan.
+	They are picked by material configuration in the material table and return score 
+	from the point of view of the strong side.
+*/
+namespace Endgame {
+
+	using EvalFunc = Score (*)(const Position& pos, enumColor strong);
+
+	// bonus of a position that is won with correct play, though mate is still beyond the horizon
+	inline constexpr int16_t known_win = 1000;
+
+	// king and mating material against bare king
+	Score KXK(const Position& pos, enumColor strong);
+	// king, bishop and knight against bare king - mate only in corner of bishop color
+	Score KBNK(const Position& pos, enumColor strong);
+	// king and pawn against bare king, exact result from the bitbase
+	Score KPK(const Position& pos, enumColor strong);
+	// material of a loaded bitbase, strong is its first side; undef when the bitbase is gone
+	Score bitbaseWin(const Position& pos, enumColor strong);
+
+} // namespace Endgame
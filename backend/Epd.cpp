@@ -0,0 +1,125 @@
+#include "Epd.hpp"
+#include "Position.hpp"
+
+#include <charconv>
+
+namespace {
+
+	using Fen::isSpace;
+
+	// counter given by hmvc or fmvn, kept as it is when the operand isn't a number fitting into it
+	template <typename T>
+	void readCounter(const std::vector<std::string>* operands, T& counter) {
+		if (!operands or operands->empty() or !Fen::isNumber(operands->front()))
+			return;
+
+		const std::string& operand = operands->front();
+		std::from_chars(operand.data(), operand.data() + operand.size(), counter);
+	}
+
+	// next opcode, skipping semicolons which end previous operations. Empty at the end of the text.
+	std::string_view nextOpcode(std::string_view text, size_t& idx) {
+		while (idx < text.size() and (isSpace(text[idx]) or text[idx] == ';'))
+			idx++;
+
+		const size_t begin = idx;
+
+		while (idx < text.size() and !isSpace(text[idx]) and text[idx] != ';')
+			idx++;
+
+		return text.substr(begin, idx - begin);
+	}
+
+	// next operand of the operation, false at the semicolon which isn't inside a string
+	bool nextOperand(std::string_view text, size_t& idx, std::string_view& operand) {
+		while (idx < text.size() and isSpace(text[idx]))
+			idx++;
+
+		if (idx >= text.size() or text[idx] == ';')
+			return false;
+
+		const bool quoted = text[idx] == '"';
+		const size_t begin = idx + quoted;
+
+		idx = quoted ? text.find('"', begin) : text.find_first_of(" \t\r\n;", begin);
+		idx = std::min(idx, text.size());
+
+		operand = text.substr(begin, idx - begin);
+		idx += quoted and idx < text.size();
+
+		return true;
+	}
+
+	void parseOperations(std::string_view text, std::vector<EpdRecord::Operation>& operations) {
+		size_t idx = 0;
+
+		for (std::string_view opcode = nextOpcode(text, idx); !opcode.empty(); opcode = nextOpcode(text, idx)) {
+			EpdRecord::Operation operation{ static_cast<std::string>(opcode), {} };
+
+			for (std::string_view operand; nextOperand(text, idx, operand); )
+				operation.operands.emplace_back(operand);
+
+			operations.push_back(std::move(operation));
+		}
+	}
+
+} // namespace
+
+const std::vector<std::string>* EpdRecord::find(std::string_view opcode) const {
+	for (const auto& operation : operations) {
+		if (operation.opcode == opcode)
+			return &operation.operands;
+	}
+
+	return nullptr;
+}
+
+bool Epd::parse(std::string_view line, EpdRecord& record, Position& pos, Fen::Error* error) {
+	record.operations.clear();
+
+	std::string_view rest;
+
+	if (!Fen::parse(line, pos, error, &rest))
+		return false;
+
+	parseOperations(rest, record.operations);
+
+	uint8_t halfmove = pos.halfmoveClock();
+	uint16_t fullmove = pos.fullmoveCount();
+
+	// counters of EPD replace those of the FEN, some tools start counting moves with 0
+	readCounter(record.find("hmvc"), halfmove);
+	readCounter(record.find("fmvn"), fullmove);
+	pos.setMoveCounters(halfmove, std::max<uint16_t>(fullmove, 1));
+
+	return true;
+}
+
+std::vector<std::string_view> Epd::splitLines(std::string_view text) {
+	std::vector<std::string_view> lines;
+
+	for (size_t begin = 0; begin < text.size(); ) {
+		size_t end = text.find('\n', begin);
+		end = end == std::string_view::npos ? text.size() : end;
+
+		const size_t length = end - begin - (end > begin and text[end - 1] == '\r');
+		lines.push_back(text.substr(begin, length));
+
+		begin = end + 1;
+	}
+
+	return lines;
+}
+
+std::string_view Epd::findOperand(std::string_view operations, std::string_view opcode) {
+	size_t idx = 0;
+
+	for (std::string_view code = nextOpcode(operations, idx); !code.empty(); code = nextOpcode(operations, idx)) {
+		for (std::string_view operand; nextOperand(operations, idx, operand); ) {
+			if (code == opcode)
+				return operand;
+		}
+	}
+
+	return std::string_view();
+}
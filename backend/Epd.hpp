@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Fen.hpp"
+
+#include <vector>
+
+/*
+	Operations of one line of EPD, which follow four position fields: bm Nf3; id "WAC.001";
+	The position itself is read by Fen::parse straight into a Position, plain FEN lines are accepted as well.
+*/
+struct EpdRecord {
+	struct Operation {
+		std::string opcode;
+		// operands separated by spaces, quotes of a string operand are removed
+		std::vector<std::string> operands;
+	};
+
+	std::vector<Operation> operations;
+
+	// operands of the operation, nullptr when there is no such operation
+	const std::vector<std::string>* find(std::string_view opcode) const;
+};
+
+namespace Epd {
+
+	// sets the position and reads the operations. Halfmove and fullmove counters come from the FEN
+	// or from hmvc and fmvn operations. Returns false for empty lines, comments and invalid positions.
+	bool parse(std::string_view line, EpdRecord& record, Position& pos, Fen::Error* error = nullptr);
+
+	// first operand of the operation in the text of operations, without quotes. Empty when there is no such operation.
+	// Unlike parse it doesn't copy anything, the operand is a view into the text.
+	std::string_view findOperand(std::string_view operations, std::string_view opcode);
+
+	// lines of a text, ending with '\n' or '\r\n'
+	std::vector<std::string_view> splitLines(std::string_view text);
+
+} // namespace Epd
@@ -1,7 +1,8 @@
 #include "Eval.hpp"
 #include "Search.hpp"
+#include "Bitbase.hpp"
 
-std::array<int16_t, 64> Eval::_mg_pawn_tables = {
+constexpr std::array<int16_t, 64> Eval::_mg_pawn_table = {
 	  0,   0,   0,   0,   0,   0,  0,   0,
 	 98, 134,  61,  95,  68, 126, 34, -11,
 	 -6,   7,  26,  31,  65,  56, 25, -20,
@@ -12,7 +13,18 @@ std::array<int16_t, 64> Eval::_mg_pawn_tables = {
 	  0,   0,   0,   0,   0,   0,  0,   0,
 };
 
-std::array<int16_t, 64> Eval::_mg_knight_tables = {
+constexpr std::array<int16_t, 64> Eval::_eg_pawn_table = {
+	  0,   0,   0,   0,   0,   0,   0,   0,
+	178, 173, 158, 134, 147, 132, 165, 187,
+	 94, 100,  85,  67,  56,  53,  82,  84,
+	 32,  24,  13,   5,  -2,   4,  17,  17,
+	 13,   9,  -3,  -7,  -7,  -8,   3,  -1,
+	  4,   7,  -6,   1,   0,  -5,  -1,  -8,
+	 13,   8,   8,  10,  13,   0,   2,  -7,
+	  0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+constexpr std::array<int16_t, 64> Eval::_mg_knight_table = {
 	-167, -89, -34, -49,  61, -97, -15, -107,
 	 -73, -41,  72,  36,  23,  62,   7,  -17,
 	 -47,  60,  37,  65,  84, 129,  73,   44,
@@ -23,7 +35,18 @@ std::array<int16_t, 64> Eval::_mg_knight_tables = {
 	-105, -21, -58, -33, -17, -28, -19,  -23,
 };
 
-std::array<int16_t, 64> Eval::_mg_bishop_tables = {
+constexpr std::array<int16_t, 64> Eval::_eg_knight_table = {
+	-58, -38, -13, -28, -31, -27, -63, -99,
+	-25,  -8, -25,  -2,  -9, -25, -24, -52,
+	-24, -20,  10,   9,  -1,  -9, -19, -41,
+	-17,   3,  22,  22,  22,  11,   8, -18,
+	-18,  -6,  16,  25,  16,  17,   4, -18,
+	-23,  -3,  -1,  15,  10,  -3, -20, -22,
+	-42, -20, -10,  -5,  -2, -20, -23, -44,
+	-29, -51, -23, -15, -22, -18, -50, -64,
+};
+
+constexpr std::array<int16_t, 64> Eval::_mg_bishop_table = {
 	-29,   4, -82, -37, -25, -42,   7,  -8,
 	-26,  16, -18, -13,  30,  59,  18, -47,
 	-16,  37,  43,  40,  35,  50,  37,  -2,
@@ -34,7 +57,18 @@ std::array<int16_t, 64> Eval::_mg_bishop_tables = {
 	-33,  -3, -14, -21, -13, -12, -39, -21,
 };
 
-std::array<int16_t, 64> Eval::_mg_rook_tables = {
+constexpr std::array<int16_t, 64> Eval::_eg_bishop_table = {
+	-14, -21, -11,  -8,  -7,  -9, -17, -24,
+	 -8,  -4,   7, -12,  -3, -13,  -4, -14,
+	  2,  -8,   0,  -1,  -2,   6,   0,   4,
+	 -3,   9,  12,   9,  14,  10,   3,   2,
+	 -6,   3,  13,  19,   7,  10,  -3,  -9,
+	-12,  -3,   8,  10,  13,   3,  -7, -15,
+	-14, -18,  -7,  -1,   4,  -9, -15, -27,
+	-23,  -9, -23,  -5,  -9, -16,  -5, -17,
+};
+
+constexpr std::array<int16_t, 64> Eval::_mg_rook_table = {
 	 32,  42,  32,  51, 63,  9,  31,  43,
 	 27,  32,  58,  62, 80, 67,  26,  44,
 	 -5,  19,  26,  36, 17, 45,  61,  16,
@@ -45,7 +79,18 @@ std::array<int16_t, 64> Eval::_mg_rook_tables = {
 	-19, -13,   1,  17, 16,  7, -37, -26,
 };
 
-std::array<int16_t, 64> Eval::_mg_queen_tables = {
+constexpr std::array<int16_t, 64> Eval::_eg_rook_table = {
+	13, 10, 18, 15, 12,  12,   8,   5,
+	11, 13, 13, 11, -3,   3,   8,   3,
+	 7,  7,  7,  5,  4,  -3,  -5,  -3,
+	 4,  3, 13,  1,  2,   1,  -1,   2,
+	 3,  5,  8,  4, -5,  -6,  -8, -11,
+	-4,  0, -5, -1, -7, -12,  -8, -16,
+	-6, -6,  0,  2, -9,  -9, -11,  -3,
+	-9,  2,  3, -1, -5, -13,   4, -20,
+};
+
+constexpr std::array<int16_t, 64> Eval::_mg_queen_table = {
 	-28,   0,  29,  12,  59,  44,  43,  45,
 	-24, -39,  -5,   1, -16,  57,  28,  54,
 	-13, -17,   7,   8,  29,  56,  47,  57,
@@ -56,7 +101,18 @@ std::array<int16_t, 64> Eval::_mg_queen_tables = {
 	 -1, -18,  -9,  10, -15, -25, -31, -50,
 };
 
-std::array<int16_t, 64> Eval::_mg_king_tables = {
+constexpr std::array<int16_t, 64> Eval::_eg_queen_table = {
+	 -9,  22,  22,  27,  27,  19,  10,  20,
+	-17,  20,  32,  41,  58,  25,  30,   0,
+	-20,   6,   9,  49,  47,  35,  19,   9,
+	  3,  22,  24,  45,  57,  40,  57,  36,
+	-18,  28,  19,  47,  31,  34,  39,  23,
+	-16, -27,  15,   6,   9,  17,  10,   5,
+	-22, -23, -30, -16, -16, -23, -36, -32,
+	-33, -28, -22, -43,  -5, -32, -20, -41,
+};
+
+constexpr std::array<int16_t, 64> Eval::_mg_king_table = {
 	-65,  23,  16, -15, -56, -34,   2,  13,
 	 29,  -1, -20,  -7,  -8,  -4, -38, -29,
 	 -9,  24,   2, -16, -20,   6,  22, -22,
@@ -67,91 +123,234 @@ std::array<int16_t, 64> Eval::_mg_king_tables = {
 	-15,  36,  12, -54,   8, -28,  24,  14,
 };
 
-std::array<int8_t, 2> Eval::_convert_factor = { 56, 7 };
+constexpr std::array<int16_t, 64> Eval::_eg_king_table = {
+	-74, -35, -18, -18, -11,  15,   4, -17,
+	-12,  17,  14,  17,  17,  38,  23,  11,
+	 10,  17,  23,  15,  20,  45,  44,  13,
+	 -8,  22,  24,  27,  26,  33,  26,   3,
+	-18,  -4,  21,  24,  27,  23,   9, -11,
+	-19,  -3,  11,  21,  23,  16,   7,  -9,
+	-27, -11,   4,  13,  14,   4,  -5, -17,
+	-53, -34, -21, -11, -28, -14, -24, -43,
+};
 
-Score Eval::matEval(const Position& pos) {
-	const enumColor turn = pos.getTurn();
-	return 
-		(pos.getQueensBySide(turn).popCount() - pos.getQueensBySide(!turn).popCount()) * 900
-		+ (pos.getRooksBySide(turn).popCount() - pos.getRooksBySide(!turn).popCount()) * 500
-		+ (pos.getBishopsBySide(turn).popCount() - pos.getBishopsBySide(!turn).popCount()) * 300
-		+ (pos.getKnightsBySide(turn).popCount() - pos.getKnightsBySide(!turn).popCount()) * 300
-		+ (pos.getPawnsBySide(turn).popCount() - pos.getPawnsBySide(!turn).popCount()) * 100;
-}
+constexpr std::array<int16_t, 6> Eval::_mg_value = { 82, 337, 365, 477, 1025, 0 },
+								 Eval::_eg_value = { 94, 281, 297, 512,  936, 0 };
 
-INLINE Score Eval::pawnsStaticEval(const Position& pos, enumColor side) {
-	BitBoard pawns = pos.getPawnsBySide(side);
-	int16_t res = 0;
+// Tables are laid out with a8 first, so white squares are flipped vertically. 
+// Black pieces use the same tables mirrored - their squares are already in table order.
+constexpr std::array<std::array<std::array<PackedScore, 64>, 6>, 2> Eval::generatePsqt() {
+	constexpr std::array<const std::array<int16_t, 64>*, 6> 
+		mg_tables = { &_mg_pawn_table, &_mg_knight_table, &_mg_bishop_table,
+					  &_mg_rook_table, &_mg_queen_table, &_mg_king_table },
+		eg_tables = { &_eg_pawn_table, &_eg_knight_table, &_eg_bishop_table,
+					  &_eg_rook_table, &_eg_queen_table, &_eg_king_table };
 
-	while (pawns) {
-		const Square sq = pawns.dropForward();
-		res += _mg_pawn_tables[sq ^ _convert_factor[side]];
+	std::array<std::array<std::array<PackedScore, 64>, 6>, 2> psqt;
+
+	for (auto piece_t : Piece::piece_list) {
+		for (int sq = 0; sq < 64; sq++) {
+			const PackedScore white = PackedScore(
+				(*mg_tables[piece_t])[sq ^ 56] + _mg_value[piece_t],
+				(*eg_tables[piece_t])[sq ^ 56] + _eg_value[piece_t]);
+			const PackedScore black = PackedScore(
+				(*mg_tables[piece_t])[sq] + _mg_value[piece_t],
+				(*eg_tables[piece_t])[sq] + _eg_value[piece_t]);
+
+			psqt[WHITE][piece_t][sq] = white;
+			psqt[BLACK][piece_t][sq] = -black;
+		}
 	}
 
-	return Score(res);
+	return psqt;
 }
 
-INLINE Score Eval::knightsStaticEval(const Position& pos, enumColor side) {
-	BitBoard knights = pos.getKnightsBySide(side);
-	int16_t res = 0;
+constexpr std::array<std::array<std::array<PackedScore, 64>, 6>, 2> Eval::_psqt = generatePsqt();
 
-	while (knights) {
-		const Square sq = knights.dropForward();
-		res += _mg_knight_tables[sq ^ _convert_factor[side]];
-	}
+void Eval::clear() {
+	_material_table.clear();
+	_cache.clear();
+}
 
-	return Score(res);
+void Eval::resetStats() {
+	_cache.resetStats();
+	_pawn_table.resetStats();
 }
 
-INLINE Score Eval::bishopsStaticEval(const Position& pos, enumColor side) {
-	BitBoard bishops = pos.getBishopsBySide(side);
-	int16_t res = 0;
+void Eval::printStats() const {
+	_cache.printStats();
+	_pawn_table.printStats();
+}
+
+void Eval::pawnStructureOnFly(const Position& pos, PawnEntry& entry) {
+	std::array<BitBoard, 2> front_span;
 
-	while (bishops) {
-		const Square sq = bishops.dropForward();
-		res += _mg_bishop_tables[sq ^ _convert_factor[side]];
+	for (enumColor side : { WHITE, BLACK }) {
+		const BitBoard pawns = pos.getPawnsBySide(side);
+
+		entry.attacks[side] = side == WHITE ? noEaOne(pawns) | noWeOne(pawns) 
+											: soEaOne(pawns) | soWeOne(pawns);
+		entry.attack_span[side] = side == WHITE ? nortFill(entry.attacks[side]) 
+												: soutFill(entry.attacks[side]);
+		front_span[side] = side == WHITE ? nortOne(nortFill(pawns)) 
+										 : soutOne(soutFill(pawns));
 	}
 
-	return Score(res);
-}
+	PackedScore score = PackedScore(0, 0);
+
+	for (enumColor side : { WHITE, BLACK }) {
+		const BitBoard pawns = pos.getPawnsBySide(side),
+					   files = fileFill(pawns);
+
+		// no opponent pawn in front, neither on the same nor on adjacent files
+		entry.passed[side] = pawns & ~(front_span[!side] | entry.attack_span[!side]);
+
+		// pawns with another own pawn behind on the same file are counted as doubled
+		PackedScore side_score = _doubled_pawn * (pawns & front_span[side]).popCount()
+							   + _isolated_pawn * (pawns & ~(eastOne(files) | westOne(files))).popCount();
+
+		BitBoard passed = entry.passed[side];
 
-INLINE Score Eval::rooksStaticEval(const Position& pos, enumColor side) {
-	BitBoard rooks = pos.getRooksBySide(side);
-	int16_t res = 0;
+		while (passed) {
+			const Square sq = passed.dropForward();
+			side_score += _passed_pawn[side == WHITE ? sq.getRank() : 7 - sq.getRank()];
+		}
 
-	while (rooks) {
-		const Square sq = rooks.dropForward();
-		res += _mg_rook_tables[sq ^ _convert_factor[side]];
+		score += side == WHITE ? side_score : -side_score;
 	}
 
-	return Score(res);
+	entry.key = pos.getPawnKey();
+	entry.score = score;
 }
 
-INLINE Score Eval::queensStaticEval(const Position& pos, enumColor side) {
-	BitBoard queens = pos.getQueensBySide(side);
-	int16_t res = 0;
+INLINE const PawnEntry& Eval::pawnStructure(const Position& pos) {
+	PawnEntry* const entry = _pawn_table.probe(pos.getPawnKey());
+
+	if (entry->key != pos.getPawnKey())
+		pawnStructureOnFly(pos, *entry);
+
+	return *entry;
+}
+
+void Eval::materialInfoOnFly(const Position& pos, MaterialEntry& entry) {
+	std::array<std::array<int, 6>, 2> count;
+	std::array<int, 2> non_pawn = {};
+
+	PackedScore score = PackedScore(0, 0);
+	int phase = 0;
+
+	for (enumColor side : { WHITE, BLACK }) {
+		PackedScore side_score = PackedScore(0, 0);
+
+		for (auto piece_t : Piece::piece_list) {
+			count[side][piece_t] = pos.getPiecesBySide(side, piece_t).popCount();
+			phase += _piece_phase[piece_t] * count[side][piece_t];
 
-	while (queens) {
-		const Square sq = queens.dropForward();
-		res += _mg_queen_tables[sq ^ _convert_factor[side]];
+			if (piece_t != Piece::PAWN)
+				non_pawn[side] += _piece_value[piece_t] * count[side][piece_t];
+		}
+
+		if (count[side][Piece::BISHOP] >= 2)
+			side_score += _bishop_pair;
+
+		score += side == WHITE ? side_score : -side_score;
+	}
+
+	entry.key = pos.getMaterialKey();
+	entry.score = score;
+	entry.phase = static_cast<uint8_t>(std::min(phase, _total_phase) * PackedScore::max_phase / _total_phase);
+	entry.endgame = nullptr;
+	entry.strong = WHITE;
+	entry.bishops_only = count[WHITE][Piece::BISHOP] == 1 and count[BLACK][Piece::BISHOP] == 1
+		and non_pawn[WHITE] == _piece_value[Piece::BISHOP] and non_pawn[BLACK] == _piece_value[Piece::BISHOP];
+
+	for (enumColor side : { WHITE, BLACK }) {
+		// without pawns, being up less than a minor piece is rarely enough to win
+		entry.scale[side] = !count[side][Piece::PAWN] and non_pawn[side] - non_pawn[!side] <= _piece_value[Piece::BISHOP] ?
+							(non_pawn[side] < _piece_value[Piece::ROOK] ? 0 : 16) : MaterialTable::scale_normal;
+
+		// two knights can't force a mate
+		if (!count[side][Piece::PAWN] and non_pawn[side] == 2 * _piece_value[Piece::KNIGHT] and count[side][Piece::KNIGHT] == 2)
+			entry.scale[side] = 0;
 	}
 
-	return res;
+	// specialised endgames against a bare king
+	for (enumColor side : { WHITE, BLACK }) {
+		const bool bare_king = !non_pawn[!side] and !count[!side][Piece::PAWN];
+
+		if (!bare_king or (!non_pawn[side] and !count[side][Piece::PAWN]))
+			continue;
+
+		entry.strong = side;
+
+		if (!non_pawn[side] and count[side][Piece::PAWN] == 1)
+			entry.endgame = &Endgame::KPK;
+		else if (!count[side][Piece::PAWN] and count[side][Piece::BISHOP] == 1 and count[side][Piece::KNIGHT] == 1 
+			and non_pawn[side] == _piece_value[Piece::BISHOP] + _piece_value[Piece::KNIGHT])
+			entry.endgame = &Endgame::KBNK;
+		else if (non_pawn[side] >= _piece_value[Piece::ROOK] or count[side][Piece::BISHOP] >= 2)
+			entry.endgame = &Endgame::KXK;
+	}
+
+	// small endgames with exact results in loaded bitbases
+	if (!entry.endgame and Bitbase::find(entry.key, entry.strong))
+		entry.endgame = &Endgame::bitbaseWin;
+}
+
+INLINE const MaterialEntry& Eval::materialInfo(const Position& pos) {
+	MaterialEntry* const entry = _material_table.probe(pos.getMaterialKey());
+
+	if (entry->key != pos.getMaterialKey())
+		materialInfoOnFly(pos, *entry);
+
+	return *entry;
 }
 
-INLINE Score Eval::kingsStaticEval(const Position& pos, enumColor side) {
-	const Square ksq = pos.getKingSquare(side);
-	return Score(_mg_king_tables[ksq ^ _convert_factor[side]]);
+INLINE PackedScore Eval::psqtEval(const Position& pos) const {
+	PackedScore score = PackedScore(0, 0);
+
+	for (enumColor side : { WHITE, BLACK }) {
+		for (auto piece_t : Piece::piece_list) {
+			BitBoard pieces = pos.getPiecesBySide(side, piece_t);
+
+			while (pieces)
+				score += _psqt[side][piece_t][pieces.dropForward()];
+		}
+	}
+
+	return score;
 }
 
 Score Eval::staticEval(const Position& pos) {
+	Score score;
+
+	if (_cache.probe(pos.getZobristKey(), score))
+		return score;
+
+	score = staticEvalOnFly(pos);
+	_cache.write(pos.getZobristKey(), score);
+
+	return score;
+}
+
+INLINE Score Eval::staticEvalOnFly(const Position& pos) {
 	const enumColor side = pos.getTurn();
+	const MaterialEntry& material = materialInfo(pos);
+
+	if (material.endgame) {
+		const Score score = material.endgame(pos, material.strong);
+
+		if (score.isValid())
+			return side == material.strong ? score : -score;
+	}
+
+	const PawnEntry& pawns = pawnStructure(pos);
+
+	// middlegame and endgame scores are summed up together and interpolated once
+	const int16_t white_score = (psqtEval(pos) + pawns.score + material.score).taper(material.phase);
+	const Score score = side == WHITE ? white_score : -white_score;
+
+	const int scale = scaleFactor(pos, material, score >= Score(0) ? side : !side);
 
-	return matEval(pos)
-		+ pawnsStaticEval(pos, side) - pawnsStaticEval(pos, !side)
-		+ knightsStaticEval(pos, side) - knightsStaticEval(pos, !side)
-		+ bishopsStaticEval(pos, side) - bishopsStaticEval(pos, !side)
-		+ rooksStaticEval(pos, side) - rooksStaticEval(pos, !side)
-		+ queensStaticEval(pos, side) - queensStaticEval(pos, !side)
-		+ kingsStaticEval(pos, side) - kingsStaticEval(pos, !side);
+	return scale == MaterialTable::scale_normal ? score : Score(score.toInt() * scale / MaterialTable::scale_normal);
 }
\ No newline at end of file
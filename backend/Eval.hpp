@@ -1,33 +1,99 @@
 #pragma once
 
 #include "Position.hpp"
+#include "PawnTable.hpp"
+#include "MaterialTable.hpp"
+#include "EvalCache.hpp"
 
 class Score;
 
 class Eval {
+	// tunes material values and PeSTO tables, with the other terms taken as they are
+	friend class Tuner;
 public:
-	Score matEval(const Position& pos);
 	Score staticEval(const Position& pos);
+
+	// start loading cached entries of the position, long before it's evaluated
+	void prefetch(const Position& pos) const;
+
+	// drops material entries and cached scores, which depend on the loaded bitbases
+	void clear();
+
+	void resetStats();
+	void printStats() const;
+
+	INLINE EvalCache& getCache() { return _cache; }
 private:
-	Score pawnsStaticEval(const Position& pos, enumColor side);
-	Score knightsStaticEval(const Position& pos, enumColor side);
-	Score bishopsStaticEval(const Position& pos, enumColor side);
-	Score rooksStaticEval(const Position& pos, enumColor side);
-	Score queensStaticEval(const Position& pos, enumColor side);
-	Score kingsStaticEval(const Position& pos, enumColor side);
+	Score staticEvalOnFly(const Position& pos);
+
+	// sum of material and piece-square scores of all the pieces, from white point of view
+	PackedScore psqtEval(const Position& pos) const;
+
+	const PawnEntry& pawnStructure(const Position& pos);
+	void pawnStructureOnFly(const Position& pos, PawnEntry& entry);
+
+	const MaterialEntry& materialInfo(const Position& pos);
+	void materialInfoOnFly(const Position& pos, MaterialEntry& entry);
+
+	// multiplier of the score out of MaterialTable::scale_normal, when the leading side is given
+	int scaleFactor(const Position& pos, const MaterialEntry& material, enumColor leading) const;
 
 	/*
 		PeSTO evaluation tables provided by Chess Programming Wiki:
 		https://www.chessprogramming.org/PeSTO%27s_Evaluation_Function 
+		Tables are given from white point of view, with a8 square first.
 	*/
 
-	static std::array<int16_t, 64>
-		_mg_pawn_tables, 
-		_mg_knight_tables, 
-		_mg_bishop_tables, 
-		_mg_rook_tables, 
-		_mg_queen_tables, 
-		_mg_king_tables;
+	static const std::array<int16_t, 64>
+		_mg_pawn_table, _eg_pawn_table,
+		_mg_knight_table, _eg_knight_table,
+		_mg_bishop_table, _eg_bishop_table,
+		_mg_rook_table, _eg_rook_table,
+		_mg_queen_table, _eg_queen_table,
+		_mg_king_table, _eg_king_table;
+
+	static const std::array<int16_t, 6> _mg_value, _eg_value;
+
+	// material and PeSTO tables merged for each color, signed from white point of view
+	static constexpr std::array<std::array<std::array<PackedScore, 64>, 6>, 2> generatePsqt();
+	static const std::array<std::array<std::array<PackedScore, 64>, 6>, 2> _psqt;
+
+	// pawn structure terms, passed pawn bonus indexed by relative rank
+	static constexpr PackedScore _doubled_pawn = PackedScore(-12, -12),
+								 _isolated_pawn = PackedScore(-10, -10);
+	static constexpr std::array<PackedScore, 8> _passed_pawn = {
+		PackedScore(0, 0), PackedScore(5, 10), PackedScore(10, 20), PackedScore(15, 30), 
+		PackedScore(30, 60), PackedScore(50, 100), PackedScore(80, 160), PackedScore(0, 0)
+	};
+
+	// material classification of endgames, indexed by piece type
+	static constexpr std::array<int16_t, 6> _piece_value = { 100, 300, 300, 500, 900, 0 },
+											_piece_phase = { 0, 1, 1, 2, 4, 0 };
+	static constexpr int _total_phase = 24;
+	static constexpr PackedScore _bishop_pair = PackedScore(30, 50);
+
+	PawnTable _pawn_table;
+	MaterialTable _material_table;
+	EvalCache _cache;
+};
+
+INLINE void Eval::prefetch(const Position& pos) const {
+	_cache.prefetch(pos.getZobristKey());
+	_pawn_table.prefetch(pos.getPawnKey());
+}
+
+INLINE int Eval::scaleFactor(const Position& pos, const MaterialEntry& material, enumColor leading) const {
+	static constexpr uint64_t dark_squares = 0xaa55aa55aa55aa55ULL;
+
+	int scale = material.scale[leading];
+
+	// bishops of opposite colors
+	if (material.bishops_only) {
+		const BitBoard bishops = pos.getBishopsBySide(WHITE) | pos.getBishopsBySide(BLACK);
+
+		if ((bishops & dark_squares) and (bishops & ~dark_squares))
+			scale = std::min(scale, 32);
+	}
 
-	static std::array<int8_t, 2> _convert_factor;
-};
\ No newline at end of file
+	return scale;
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "EvalCache.hpp"
+
+EvalCache::EvalCache() {
+	resize(default_size_mb);
+}
+
+void EvalCache::resize(size_t size_mb) {
+	_mem.clear();
+	_mem.shrink_to_fit();
+	_mask = 0;
+
+	if (!size_mb)
+		return;
+
+	// largest power of two number of entries fitting in given size
+	size_t entries = 1;
+
+	while (entries * 2 * sizeof(uint64_t) <= size_mb * 1024 * 1024)
+		entries *= 2;
+
+	_mem.resize(entries);
+	_mask = entries - 1;
+
+	clear();
+}
+
+void EvalCache::clear() {
+	std::fill(_mem.begin(), _mem.end(), 0ULL);
+}
+
+void EvalCache::resetStats() {
+	_probes = 0;
+	_hits = 0;
+}
+
+void EvalCache::printStats() const {
+	std::cout << "info string eval cache hits " << _hits << '/' << _probes
+		<< " (" << (_probes ? _hits * 100.f / _probes : 0.f) << "%)\n";
+}
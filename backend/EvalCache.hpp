@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Intrinsics.hpp"
+#include "Score.hpp"
+
+#include <vector>
+
+/*
+	Lossy cache of static evaluations, keyed by the Zobrist key of a position, so transpositions 
+	and null move re-searches don't evaluate the same position twice. An entry is a single 64-bit word: 
+	upper 48 bits of the key verify the position and low 16 bits hold the score, from the side to move 
+	point of view. Direct-mapped and always-replace, the cache is owned by a single search thread.
+*/
+class EvalCache {
+public:
+	EvalCache();
+
+	// cache of 0 MB is disabled
+	void resize(size_t size_mb);
+	void clear();
+
+	bool probe(uint64_t key, Score& out_score);
+	void write(uint64_t key, Score score);
+	void prefetch(uint64_t key) const;
+
+	void resetStats();
+	void printStats() const;
+
+	static constexpr size_t default_size_mb = 2;
+private:
+	static constexpr uint64_t _key_mask = ~0xffffULL;
+
+	std::vector<uint64_t> _mem;
+	size_t _mask = 0;
+
+	uint64_t _probes = 0,
+			 _hits = 0;
+};
+
+INLINE bool EvalCache::probe(uint64_t key, Score& out_score) {
+	if (_mem.empty())
+		return false;
+
+	const uint64_t entry = _mem[key & _mask];
+
+	_probes++;
+
+	if ((entry ^ key) & _key_mask)
+		return false;
+
+	_hits++;
+	out_score = Score(static_cast<uint16_t>(entry));
+	return true;
+}
+
+INLINE void EvalCache::write(uint64_t key, Score score) {
+	if (!_mem.empty())
+		_mem[key & _mask] = (key & _key_mask) | static_cast<uint16_t>(score.toInt());
+}
+
+INLINE void EvalCache::prefetch(uint64_t key) const {
+	if (!_mem.empty())
+		Intrinsics::prefetch(&_mem[key & _mask]);
+}
@@ -0,0 +1,388 @@
+#include "Fen.hpp"
+#include "MoveGen.hpp"
+#include "PackedPosition.hpp"
+#include "Position.hpp"
+#include "Time.hpp"
+
+#include <charconv>
+#include <random>
+#include <vector>
+
+namespace {
+
+	// color << 3 | type of a piece letter, none for other characters
+	constexpr uint8_t none = 0xff;
+
+	constexpr std::array<uint8_t, 128> piece_codes = [] {
+		std::array<uint8_t, 128> codes = {};
+		codes.fill(none);
+
+		for (uint8_t i = 0; i < 6; i++) {
+			codes["PNBRQK"[i]] = i;
+			codes["pnbrqk"[i]] = BLACK << 3 | i;
+		}
+
+		return codes;
+	}();
+
+	constexpr std::array<std::string_view, 2> piece_letters = { "PNBRQK", "pnbrqk" };
+
+	// column of the field, counted from 1 - fields are views into the text
+	INLINE size_t columnOf(std::string_view text, std::string_view field) {
+		return static_cast<size_t>(field.data() - text.data()) + 1;
+	}
+
+	INLINE bool fail(Fen::Error* error, const char* message, size_t column) {
+		if (error)
+			*error = Fen::Error{ message, column };
+
+		return false;
+	}
+
+	// digits only, their count is checked by the caller
+	INLINE uint32_t toNumber(std::string_view str) {
+		uint32_t value = 0;
+
+		for (char c : str)
+			value = value * 10 + static_cast<uint32_t>(c - '0');
+
+		return value;
+	}
+
+	// king of the side attacked by any piece of the other side, kings included
+	bool isKingAttacked(const std::array<std::array<BitBoard, 6>, 2>& pieces, enumColor side) {
+		BitBoard occupied = BitBoard::empty;
+
+		for (enumColor col : { WHITE, BLACK }) {
+			for (auto piece_t : Piece::piece_list)
+				occupied |= pieces[col][piece_t];
+		}
+
+		const Square king_sq = pieces[side][Piece::KING].bitScanForward();
+		const auto& enemy = pieces[!side];
+
+		return (pawnAttacks(king_sq, side) & enemy[Piece::PAWN])
+			or (knightAttacks(king_sq) & enemy[Piece::KNIGHT])
+			or (kingAttacks(king_sq) & enemy[Piece::KING])
+			or (SlidersMagics::bishopAttacks(king_sq, occupied) & (enemy[Piece::BISHOP] | enemy[Piece::QUEEN]))
+			or (SlidersMagics::rookAttacks(king_sq, occupied) & (enemy[Piece::ROOK] | enemy[Piece::QUEEN]));
+	}
+
+} // namespace
+
+std::string Fen::Error::toStr() const {
+	return message ? std::string(message) + " at column " + std::to_string(column) : "no error";
+}
+
+bool Fen::parse(std::string_view text, Position& pos, Error* error, std::string_view* rest) {
+	std::array<std::array<BitBoard, 6>, 2> pieces = {};
+	std::array<int, 2> kings = {}, pawns = {}, count = {};
+
+	size_t idx = 0;
+	const std::string_view board = nextField(text, idx);
+
+	if (board.empty())
+		return fail(error, "missing board", columnOf(text, board));
+
+	int rank = 7, file = 0;
+
+	for (size_t i = 0; i < board.size(); i++) {
+		const char c = board[i];
+		const size_t column = columnOf(text, board) + i;
+
+		if (c == '/') {
+			if (file != 8)
+				return fail(error, "rank of fewer than 8 squares", column);
+			if (!rank)
+				return fail(error, "more than 8 ranks", column);
+
+			rank--, file = 0;
+			continue;
+		}
+
+		if ('1' <= c and c <= '8') {
+			file += c - '0';
+
+			if (file > 8)
+				return fail(error, "rank of more than 8 squares", column);
+
+			continue;
+		}
+
+		const uint8_t code = static_cast<unsigned char>(c) < piece_codes.size() ? piece_codes[c] : none;
+
+		if (code == none)
+			return fail(error, "invalid character on board", column);
+		if (file == 8)
+			return fail(error, "rank of more than 8 squares", column);
+
+		const enumColor col = static_cast<enumColor>(code >> 3);
+		const Piece::enumType piece_t = static_cast<Piece::enumType>(code & 7);
+
+		if (piece_t == Piece::PAWN and (rank == 0 or rank == 7))
+			return fail(error, "pawn on the first or the last rank", column);
+		if (piece_t == Piece::KING and ++kings[col] > 1)
+			return fail(error, "more than one king of a color", column);
+		// more would need promotions out of thin air, and wouldn't fit into PackedPosition
+		if (piece_t == Piece::PAWN and ++pawns[col] > 8)
+			return fail(error, "more than 8 pawns of a color", column);
+		if (++count[col] > 16)
+			return fail(error, "more than 16 pieces of a color", column);
+
+		pieces[col][piece_t].setBit(rank * 8 + file++);
+	}
+
+	if (rank or file != 8)
+		return fail(error, "board of fewer than 8 ranks", columnOf(text, board) + board.size());
+	if (!kings[WHITE] or !kings[BLACK])
+		return fail(error, "missing king", columnOf(text, board));
+
+	const std::string_view turn_field = nextField(text, idx);
+
+	if (turn_field != "w" and turn_field != "b")
+		return fail(error, "side to move isn't w or b", columnOf(text, turn_field));
+
+	const enumColor turn = turn_field == "w" ? WHITE : BLACK;
+
+	if (isKingAttacked(pieces, !turn))
+		return fail(error, "side not to move is in check", columnOf(text, turn_field));
+
+	// a right needs king and rook on their initial squares
+	const std::string_view castling = nextField(text, idx);
+	std::array<CastlingRights, 2> castling_rights = { CastlingRights(false, false), CastlingRights(false, false) };
+
+	if (castling.empty())
+		return fail(error, "missing castling rights", columnOf(text, castling));
+
+	if (castling != "-") {
+		for (size_t i = 0; i < castling.size(); i++) {
+			const size_t right = std::string_view("KQkq").find(castling[i]);
+
+			if (right == std::string_view::npos)
+				return fail(error, "invalid castling right", columnOf(text, castling) + i);
+
+			const enumColor col = right < 2 ? WHITE : BLACK;
+			const bool short_castle = right % 2 == 0;
+			const int home = col == WHITE ? 0 : 56;
+
+			if (!pieces[col][Piece::KING].isOccupiedSq(home + 4)
+				or !pieces[col][Piece::ROOK].isOccupiedSq(home + (short_castle ? 7 : 0)))
+				return fail(error, "castling right without king and rook on their squares", columnOf(text, castling) + i);
+
+			if (short_castle)
+				castling_rights[col].setKingSide(true);
+			else
+				castling_rights[col].setQueenSide(true);
+		}
+	}
+
+	// square behind a pawn, which has just moved two squares forward
+	const std::string_view ep = nextField(text, idx);
+	Square ep_square = Square::none;
+
+	if (ep.empty())
+		return fail(error, "missing en passant square", columnOf(text, ep));
+
+	if (ep != "-") {
+		const char ep_rank = turn == WHITE ? '6' : '3';
+
+		if (ep.size() != 2 or ep[0] < 'a' or 'h' < ep[0] or ep[1] != ep_rank)
+			return fail(error, "invalid en passant square", columnOf(text, ep));
+
+		ep_square = Square(static_cast<uint8_t>((ep[1] - '1') * 8 + ep[0] - 'a'));
+
+		if (!pieces[!turn][Piece::PAWN].isOccupiedSq(turn == WHITE ? ep_square - 8 : ep_square + 8))
+			return fail(error, "en passant square without a pawn which has just moved", columnOf(text, ep));
+	}
+
+	// counters are optional, EPD has operations there
+	uint32_t halfmove = 0, fullmove = 1;
+	size_t counters_idx = idx;
+
+	if (const std::string_view field = nextField(text, counters_idx); isNumber(field)) {
+		if (field.size() > 3 or (halfmove = toNumber(field)) > 255)
+			return fail(error, "halfmove clock out of range", columnOf(text, field));
+
+		idx = counters_idx;
+
+		if (const std::string_view fullmove_field = nextField(text, counters_idx); isNumber(fullmove_field)) {
+			if (fullmove_field.size() > 5 or (fullmove = toNumber(fullmove_field)) > 65535)
+				return fail(error, "fullmove number out of range", columnOf(text, fullmove_field));
+
+			// some tools start counting with 0
+			fullmove = std::max(fullmove, 1U);
+			idx = counters_idx;
+		}
+	}
+
+	if (rest) {
+		while (idx < text.size() and isSpace(text[idx]))
+			idx++;
+
+		*rest = text.substr(idx);
+	}
+
+	pos.setByPieces(pieces, turn, castling_rights, ep_square, static_cast<uint8_t>(halfmove), static_cast<uint16_t>(fullmove));
+
+	return true;
+}
+
+size_t Fen::write(const Position& pos, char* out) {
+	std::array<char, 64> board = {};
+
+	for (enumColor col : { WHITE, BLACK }) {
+		for (auto piece_t : Piece::piece_list) {
+			for (uint64_t bb = pos.getPiecesBySide(col, piece_t); bb; bb &= bb - 1)
+				board[Intrinsics::bitScanForward64(bb)] = piece_letters[col][piece_t];
+		}
+	}
+
+	char* const begin = out;
+
+	for (int rank = 7; rank >= 0; rank--) {
+		char empty = 0;
+
+		for (int file = 0; file < 8; file++) {
+			const char c = board[rank * 8 + file];
+
+			if (!c) {
+				empty++;
+				continue;
+			}
+
+			if (empty)
+				*out++ = static_cast<char>('0' + empty), empty = 0;
+
+			*out++ = c;
+		}
+
+		if (empty)
+			*out++ = static_cast<char>('0' + empty);
+
+		if (rank)
+			*out++ = '/';
+	}
+
+	*out++ = ' ';
+	*out++ = pos.getTurn() == WHITE ? 'w' : 'b';
+	*out++ = ' ';
+
+	const CastlingRights white = pos.getCastlingByColor(WHITE),
+						 black = pos.getCastlingByColor(BLACK);
+
+	if (!white.isAnyPossible() and !black.isAnyPossible())
+		*out++ = '-';
+
+	if (white.isShortPossible()) *out++ = 'K';
+	if (white.isLongPossible())  *out++ = 'Q';
+	if (black.isShortPossible()) *out++ = 'k';
+	if (black.isLongPossible())  *out++ = 'q';
+
+	*out++ = ' ';
+
+	const Square ep_square = pos.getEnPassantSq();
+
+	if (ep_square.isNull())
+		*out++ = '-';
+	else {
+		*out++ = static_cast<char>('a' + ep_square.getFile());
+		*out++ = static_cast<char>('1' + ep_square.getRank());
+	}
+
+	*out++ = ' ';
+	out = std::to_chars(out, out + 3, static_cast<unsigned>(pos.halfmoveClock())).ptr;
+	*out++ = ' ';
+	out = std::to_chars(out, out + 5, static_cast<unsigned>(pos.fullmoveCount())).ptr;
+
+	return static_cast<size_t>(out - begin);
+}
+
+std::string Fen::toStr(const Position& pos) {
+	std::array<char, max_length> buffer;
+	return std::string(buffer.data(), write(pos, buffer.data()));
+}
+
+void Fen::benchmark(const std::vector<std::string>& fens, size_t conversions) {
+	static constexpr size_t samples_cnt = 1 << 12;
+	static constexpr unsigned max_plies = 100;
+
+	std::vector<Position> samples;
+	samples.reserve(samples_cnt);
+
+	for (const auto& fen : fens) {
+		Position pos;
+
+		if (samples.size() < samples_cnt and parse(fen, pos))
+			samples.push_back(pos);
+	}
+
+	const size_t given = samples.size();
+
+	if (!given) {
+		std::cout << "no valid position to convert\n";
+		return;
+	}
+
+	// fill the rest with positions of random games, starting from the given ones
+	std::mt19937_64 engine(0x1eaf);
+
+	for (size_t start = 0; samples.size() < samples_cnt; start++) {
+		Position pos = samples[start % given];
+		Position::IrreversibleState state;
+
+		for (unsigned ply = 0; ply < max_plies and samples.size() < samples_cnt; ply++) {
+			MoveList legal_moves;
+			MoveGen::generateLegalMoves(pos, legal_moves);
+
+			if (!legal_moves.count())
+				break;
+
+			Move move = legal_moves.getMove(engine() % legal_moves.count());
+			pos.make(move, state);
+			samples.push_back(pos);
+		}
+	}
+
+	// every conversion has to come back to the same position, with the same keys
+	std::vector<std::string> texts;
+	std::vector<PackedPosition> packed;
+	size_t errors = 0;
+
+	for (const auto& sample : samples) {
+		Position pos;
+
+		texts.push_back(toStr(sample));
+		packed.push_back(PackedPosition::pack(sample));
+
+		errors += !parse(texts.back(), pos) or pos.getZobristKey() != sample.getZobristKey()
+			or pos.getPawnKey() != sample.getPawnKey() or toStr(pos) != texts.back();
+
+		packed.back().unpack(pos);
+		errors += pos.getZobristKey() != sample.getZobristKey() or toStr(pos) != texts.back();
+	}
+
+	std::cout << samples.size() << " positions, round trip errors " << errors << '\n';
+
+	const auto measure = [conversions](const char* name, auto&& convert) {
+		uint64_t sink = 0;
+		Timer timer;
+		timer.go();
+
+		for (size_t i = 0; i < conversions; i++)
+			sink += convert(i & (samples_cnt - 1));
+
+		timer.stop();
+		const auto duration_ms = std::max<decltype(timer.duration())>(timer.duration(), 1);
+
+		std::cout << name << ": " << conversions << " positions in " << duration_ms << " ms, "
+			<< conversions * 1000 / duration_ms << " positions/s (checksum " << (sink & 0xffff) << ")\n";
+	};
+
+	Position pos;
+	std::array<char, max_length> buffer;
+
+	measure("fen parse", [&](size_t i) { parse(texts[i], pos); return pos.getZobristKey(); });
+	measure("fen write", [&](size_t i) { return write(samples[i], buffer.data()) + buffer[0]; });
+	measure("pack", [&](size_t i) { return PackedPosition::pack(samples[i]).occupancy; });
+	measure("unpack", [&](size_t i) { packed[i].unpack(pos); return pos.getZobristKey(); });
+}
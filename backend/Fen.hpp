@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Common.hpp"
+
+#include <vector>
+
+class Position;
+
+/*
+	FEN reading and writing without any temporary strings. The parser goes over the text once and fills
+	piece bitboards, which are set into the position all at once, so the keys are computed only once
+	as well. EPD positions are read too: when the four position fields aren't followed by move counters,
+	the counters are 0 and 1 and the rest of the text holds EPD operations.
+
+	A position is checked while it's read: eight ranks of eight files, a king of each color, no pawns
+	on the first and the last rank, castling rights only with king and rook on their squares,
+	en passant square behind a pawn which has just moved and the side not to move not in check.
+*/
+namespace Fen {
+
+	// helpers of the parser, shared with EPD
+	INLINE bool isSpace(char c) {
+		return c == ' ' or c == '\t' or c == '\r' or c == '\n';
+	}
+
+	INLINE bool isNumber(std::string_view str) {
+		return !str.empty() and std::all_of(str.begin(), str.end(), [](char c) { return '0' <= c and c <= '9'; });
+	}
+
+	// next field separated by spaces, starting from idx
+	INLINE std::string_view nextField(std::string_view text, size_t& idx) {
+		while (idx < text.size() and isSpace(text[idx]))
+			idx++;
+
+		const size_t begin = idx;
+
+		while (idx < text.size() and !isSpace(text[idx]))
+			idx++;
+
+		return text.substr(begin, idx - begin);
+	}
+
+	struct Error {
+		// description of the first problem found, nullptr when there is none
+		const char* message = nullptr;
+		// column of the character where the problem has been found, counted from 1
+		size_t column = 0;
+
+		std::string toStr() const;
+	};
+
+	// the position is set only when the text is valid, otherwise the error describes why it isn't.
+	// Text following the position, e.g. EPD operations, is left in rest without leading spaces.
+	bool parse(std::string_view text, Position& pos, Error* error = nullptr, std::string_view* rest = nullptr);
+
+	// longest FEN written: full board, all castling rights, en passant square and counters of 3 and 5 digits
+	static constexpr size_t max_length = 71 + 1 + 1 + 1 + 4 + 1 + 2 + 1 + 3 + 1 + 5;
+
+	// writes FEN of the position into out, which has room for max_length characters. Returns the length.
+	size_t write(const Position& pos, char* out);
+	std::string toStr(const Position& pos);
+
+	// speed of conversions of positions into FEN and packed positions and back, checked by round trips first.
+	// Positions of random games starting from the given ones are added to make a few thousand samples.
+	void benchmark(const std::vector<std::string>& fens, size_t conversions);
+
+} // namespace Fen
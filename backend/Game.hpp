@@ -25,6 +25,18 @@ public:
 	}
 
 	INLINE size_t currentHalfCount() const { return _idx; }
+
+	// position of the key has occurred twice before, since the last irreversible move
+	INLINE bool isThreefold(uint64_t key, unsigned halfmove_clock) const {
+		const size_t end = std::min<size_t>(halfmove_clock, _idx);
+		int repetitions = 0;
+
+		for (size_t i = 2; i <= end; i += 2)
+			repetitions += _key_history[_idx - i] == key;
+
+		return repetitions >= 2;
+	}
+
 	INLINE void clear() { _idx = 0; }
 private:
 	std::array<Move, max_game_moves> _move_history;
@@ -1,45 +1,49 @@
 #include "Hash.hpp"
 #include "Position.hpp"
+#include "Attacks.hpp"
 
 #include <random>
 
 static constexpr int random_seed = 0xfff;
 
+// keys have to be uniformly distributed - sparse keys would make cuckoo tables cycle
 INLINE uint64_t randomU64() {
 	static std::mt19937_64 engine(random_seed);
 	static std::uniform_int_distribution<uint64_t> dist(1, std::numeric_limits<uint64_t>::max());
-	return dist(engine) & dist(engine);
+	return dist(engine);
 }
 
-void ZobristHash::fillKeys() {
+void ZobristKeys::fill() {
 	for (int sq = 0; sq < 64; sq++) {
 		for (enumColor col : { WHITE, BLACK }) {
 			for (auto piece_t : Piece::piece_list) {
-				_piece_keys[col][piece_t][sq] = randomU64();
+				piece[col][piece_t][sq] = randomU64();
 			}
 		}
 	}
 
-	_black_key = randomU64();
+	black = randomU64();
 
 	for (int file = 0; file < 8; file++) {
-		_ep_file_keys[file] = randomU64();
+		ep_file[file] = randomU64();
 	}
 
 	for (enumColor col : { WHITE, BLACK }) {
-		_short_castle_keys[col] = randomU64();
-		_long_castle_keys[col] = randomU64();
+		short_castle[col] = randomU64();
+		long_castle[col] = randomU64();
 	}
 }
 
 uint64_t ZobristHash::generateOnFly(const Position& pos) {
 	uint64_t key = 0;
 
-	for (int sq = 0; sq < 64; sq++) {
-		const Piece piece = pos.pieceOn(sq);
+	for (enumColor col : { WHITE, BLACK }) {
+		for (auto piece_t : Piece::piece_list) {
+			BitBoard pieces = pos.getPiecesBySide(col, piece_t);
 
-		if (piece.getType() != Piece::NONE)
-			key ^= _piece_keys[piece.getColor()][piece.getType()][sq];
+			while (pieces)
+				key ^= _piece_keys[col][piece_t][pieces.dropForward()];
+		}
 	}
 
 	if (pos.getTurn() == BLACK)
@@ -64,9 +68,88 @@ uint64_t ZobristHash::generateOnFly(const Position& pos) {
 	return key;
 }
 
+uint64_t ZobristHash::generatePawnKeyOnFly(const Position& pos) {
+	uint64_t key = 0;
+
+	for (enumColor col : { WHITE, BLACK }) {
+		BitBoard pawns = pos.getPawnsBySide(col);
+
+		while (pawns)
+			key ^= _piece_keys[col][Piece::PAWN][pawns.dropForward()];
+	}
+
+	return key;
+}
+
+// n-th piece of given type and color contributes with a key of n-th square, 
+// so the key depends only on piece counts
+uint64_t ZobristHash::generateMaterialKeyOnFly(const Position& pos) {
+	uint64_t key = 0;
+
+	for (enumColor col : { WHITE, BLACK }) {
+		for (auto piece_t : Piece::piece_list) {
+			const int count = pos.getPiecesBySide(col, piece_t).popCount();
+
+			for (int i = 0; i < count; i++)
+				key ^= _piece_keys[col][piece_t][i];
+		}
+	}
+
+	return key;
+}
+
 #if defined(_DEBUG)
 bool ZobristHash::printXOR_Diff(uint64_t key_2) {
 	std::cout << (_key ^ key_2) << ' ';
 	return true;
 }
 #endif
+
+void CuckooTables::init() {
+	keys.fill(0);
+
+	// only empty board attacks are needed - slider attacks are generated as rays
+	[[maybe_unused]] int count = 0;
+
+	for (enumColor col : { WHITE, BLACK }) {
+		for (auto piece_t : Piece::piece_list) {
+			if (piece_t == Piece::PAWN)
+				continue;
+
+			for (int org = 0; org < 64; org++) {
+				const BitBoard att = piece_t == Piece::KNIGHT ? knightAttacks(org)
+								   : piece_t == Piece::BISHOP ? rayAttacksBishop(org)
+								   : piece_t == Piece::ROOK   ? rayAttacksRook(org)
+								   : piece_t == Piece::QUEEN  ? rayAttacksQueen(org)
+								   : kingAttacks(org);
+
+				for (int dst = org + 1; dst < 64; dst++) {
+					if (!att.getBit(dst))
+						continue;
+
+					uint64_t key = zobrist_keys.piece[col][piece_t][org] 
+								 ^ zobrist_keys.piece[col][piece_t][dst] 
+								 ^ zobrist_keys.black;
+					Entry move = Entry{ Square(org), Square(dst), piece_t };
+
+					// insert, kicking out entries to their alternative slots until an empty one is found
+					size_t i = h1(key);
+
+					for (;;) {
+						std::swap(keys[i], key);
+						std::swap(moves[i], move);
+
+						if (!key)
+							break;
+
+						i = i == h1(key) ? h2(key) : h1(key);
+					}
+
+					count++;
+				}
+			}
+		}
+	}
+
+	assert(count == 3668);
+}
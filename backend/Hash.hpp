@@ -1,29 +1,84 @@
 #pragma once
 
 #include "Common.hpp"
+#include "Square.hpp"
+#include "Piece.hpp"
 
 class Position;
 
+// random keys, generated once and shared by all the positions
+struct ZobristKeys {
+	ZobristKeys() { fill(); }
+
+	void fill();
+
+	// C-style multidimensional arrays are used there simply because of 
+	// simplicity in declaration in opposite to std::array class template
+	uint64_t piece[2][6][64];
+	uint64_t black;
+	uint64_t ep_file[8];
+	uint64_t short_castle[2], long_castle[2];
+};
+
+inline const ZobristKeys zobrist_keys;
+
 class ZobristHash {
 public:
 	friend class Position;
 
-	inline ZobristHash() { fillKeys(); }
-
-	void fillKeys();
 	uint64_t generateOnFly(const Position& pos);
+	// key of the pawns only, indexes pawn structure hash table
+	uint64_t generatePawnKeyOnFly(const Position& pos);
+	// key of piece counts, indexes material hash table
+	uint64_t generateMaterialKeyOnFly(const Position& pos);
 
 #if defined(_DEBUG)
 	bool printXOR_Diff(uint64_t key_2);
 #endif
 
 private:
-	// C-style multidimensional arrays are used there simply because of 
-	// simplicity in declaration in opposite to std::array class template
-	uint64_t _piece_keys[2][6][64];
-	uint64_t _black_key;
-	uint64_t _ep_file_keys[8];
-	uint64_t _short_castle_keys[2], _long_castle_keys[2];
+	static constexpr const auto& _piece_keys = zobrist_keys.piece;
+	static constexpr const auto& _black_key = zobrist_keys.black;
+	static constexpr const auto& _ep_file_keys = zobrist_keys.ep_file;
+	static constexpr const auto& _short_castle_keys = zobrist_keys.short_castle;
+	static constexpr const auto& _long_castle_keys = zobrist_keys.long_castle;
+
+	uint64_t _key = 0,
+			 _pawn_key = 0,
+			 _material_key = 0;
+};
+
+/*
+	Cuckoo tables of all the reversible moves on an empty board, indexed by the move key 
+	(XOR of both squares keys of a piece and side to move key). Used for detection 
+	of upcoming repetitions, as described by Marcel van Kervinck:
+	http://web.archive.org/web/20201107002606/https://marcelk.net/2013-04-06/paper/upcoming-rep-v2.pdf
+*/
+struct CuckooTables {
+	struct Entry {
+		Square org, dst;
+		Piece::enumType piece_t;
+	};
+
+	CuckooTables() { init(); }
+
+	void init();
+
+	// returns nullptr if there is no reversible move with given key
+	INLINE const Entry* find(uint64_t move_key) const {
+		size_t i = h1(move_key);
+		if (keys[i] == move_key) return &moves[i];
+		i = h2(move_key);
+		return keys[i] == move_key ? &moves[i] : nullptr;
+	}
+
+	static INLINE size_t h1(uint64_t key) { return key & (size - 1); }
+	static INLINE size_t h2(uint64_t key) { return (key >> 16) & (size - 1); }
+
+	static constexpr size_t size = 8192;
+
+	std::array<uint64_t, size> keys;
+	std::array<Entry, size> moves;
+};
 
-	uint64_t _key = 0;
-};
\ No newline at end of file
+inline const CuckooTables cuckoo_tables;
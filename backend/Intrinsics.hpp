@@ -0,0 +1,183 @@
+#pragma once
+
+#include "Common.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) or defined(__i386__)
+#include <x86intrin.h>
+#include <cpuid.h>
+#endif
+
+#if __has_include(<bit>)
+#include <bit>
+#endif
+
+/*
+	Portable bit manipulation layer. Every routine maps to a single instruction
+	when compiler and target allow it: MSVC intrinsics, C++20 <bit> header (lowered to
+	popcnt/tzcnt/lzcnt by GCC and Clang) or GCC/Clang builtins, with plain C++ fallback.
+	Instruction set level is fixed at compile time - see build flavours in CMakeLists.txt -
+	except for PEXT, which is chosen at runtime.
+*/
+
+#if defined(_M_X64) or defined(_M_AMD64) or defined(__x86_64__) or defined(__i386__)
+#define X86_AVAILABLE
+#endif
+
+// PEXT is compiled in on every x86-64 target. Without -mbmi2, GCC and Clang build the functions marked
+// with PEXT_FUNCTION for BMI2 anyway - they can't be inlined into the rest of the code then and they
+// may be called only after CPUID has found BMI2, see SlidersMagics::hasFastPext.
+#if defined(__BMI2__) or (defined(_MSC_VER) and (defined(_M_X64) or defined(_M_AMD64)))
+#define PEXT_AVAILABLE
+#define PEXT_FUNCTION INLINE
+#elif defined(__x86_64__) and defined(__GNUC__)
+#define PEXT_AVAILABLE
+#define PEXT_FUNCTION inline __attribute__((target("bmi2")))
+#endif
+
+// name of the instruction set level the binary was compiled for
+#if defined(__AVX512F__) and defined(__AVX512BW__) and defined(__AVX512VL__)
+#define ARCH_NAME "x86-64-v4"
+#elif defined(__AVX2__) and defined(__BMI2__)
+#define ARCH_NAME "x86-64-v3"
+#elif defined(__SSE4_2__) and defined(__POPCNT__)
+#define ARCH_NAME "x86-64-v2"
+#elif defined(X86_AVAILABLE)
+#define ARCH_NAME "x86-64"
+#else
+#define ARCH_NAME "generic"
+#endif
+
+namespace Intrinsics {
+
+	// bit scans usable in constant expressions and as a fallback, credits to:
+	//  https://www.chessprogramming.org/BitScan
+
+	inline constexpr int index64[64] = {
+		0, 47,  1, 56, 48, 27,  2, 60,
+	   57, 49, 41, 37, 28, 16,  3, 61,
+	   54, 58, 35, 52, 50, 42, 21, 44,
+	   38, 32, 29, 23, 17, 11,  4, 62,
+	   46, 55, 26, 59, 40, 36, 15, 53,
+	   34, 51, 20, 43, 31, 22, 10, 45,
+	   25, 39, 14, 33, 19, 30,  9, 24,
+	   13, 18,  8, 12,  7,  6,  5, 63
+	};
+
+	inline constexpr uint64_t debruijn64 = 0x03f79d71b4cb0a89ULL;
+
+	INLINE constexpr int constBitScanForward64(uint64_t bb) {
+		return index64[((bb ^ (bb - 1)) * debruijn64) >> 58];
+	}
+
+	INLINE constexpr int constBitScanReverse64(uint64_t bb) {
+		bb |= bb >> 1;
+		bb |= bb >> 2;
+		bb |= bb >> 4;
+		bb |= bb >> 8;
+		bb |= bb >> 16;
+		bb |= bb >> 32;
+		return index64[(bb * debruijn64) >> 58];
+	}
+
+	INLINE int popCount64(uint64_t bb) {
+#if defined(_MSC_VER)
+		return static_cast<int>(__popcnt64(bb));
+#elif defined(__cpp_lib_bitops)
+		return std::popcount(bb);
+#elif defined(__GNUC__)
+		return __builtin_popcountll(bb);
+#else
+		int c;
+		for (c = 0; bb; bb &= bb - 1, c++);
+		return c;
+#endif
+	}
+
+	// index of the least significant set bit, bb can't be empty
+	INLINE int bitScanForward64(uint64_t bb) {
+		assert(bb != 0);
+#if defined(_MSC_VER)
+		unsigned long s;
+		_BitScanForward64(&s, bb);
+		return static_cast<int>(s);
+#elif defined(__cpp_lib_bitops)
+		return std::countr_zero(bb);
+#elif defined(__GNUC__)
+		return __builtin_ctzll(bb);
+#else
+		return constBitScanForward64(bb);
+#endif
+	}
+
+	// index of the most significant set bit, bb can't be empty
+	INLINE int bitScanReverse64(uint64_t bb) {
+		assert(bb != 0);
+#if defined(_MSC_VER)
+		unsigned long s;
+		_BitScanReverse64(&s, bb);
+		return static_cast<int>(s);
+#elif defined(__cpp_lib_bitops)
+		return 63 ^ std::countl_zero(bb);
+#elif defined(__GNUC__)
+		return 63 ^ __builtin_clzll(bb);
+#else
+		return constBitScanReverse64(bb);
+#endif
+	}
+
+	// parallel bits extract - gather bits of bb selected by mask into the low bits of result
+#if defined(PEXT_AVAILABLE)
+	PEXT_FUNCTION uint64_t pext64(uint64_t bb, uint64_t mask) {
+		return _pext_u64(bb, mask);
+	}
+#else
+	INLINE uint64_t pext64(uint64_t bb, uint64_t mask) {
+		uint64_t res = 0;
+
+		for (uint64_t bit = 1; mask; bit <<= 1, mask &= mask - 1) {
+			if (bb & mask & (0 - mask)) res |= bit;
+		}
+
+		return res;
+	}
+#endif
+
+	// hint the CPU to pull the cache line of addr into all cache levels
+	INLINE void prefetch(const void* addr) {
+#if defined(_MSC_VER) and defined(X86_AVAILABLE)
+		_mm_prefetch(static_cast<const char*>(addr), _MM_HINT_T0);
+#elif defined(__GNUC__)
+		__builtin_prefetch(addr);
+#else
+		(void)addr;
+#endif
+	}
+
+	// returns false on CPUs without CPUID instruction or without given leaf
+	INLINE bool cpuid(std::array<int, 4>& regs, int leaf, int subleaf = 0) {
+		regs.fill(0);
+#if defined(_MSC_VER) and defined(X86_AVAILABLE)
+		__cpuid(regs.data(), leaf & 0x80000000);
+
+		if (static_cast<unsigned>(regs[0]) < static_cast<unsigned>(leaf))
+			return false;
+
+		__cpuidex(regs.data(), leaf, subleaf);
+		return true;
+#elif defined(X86_AVAILABLE) and defined(__GNUC__)
+		unsigned int eax, ebx, ecx, edx;
+
+		if (!__get_cpuid_count(leaf, subleaf, &eax, &ebx, &ecx, &edx))
+			return false;
+
+		regs = { static_cast<int>(eax), static_cast<int>(ebx), static_cast<int>(ecx), static_cast<int>(edx) };
+		return true;
+#else
+		(void)leaf, (void)subleaf;
+		return false;
+#endif
+	}
+
+} // namespace Intrinsics
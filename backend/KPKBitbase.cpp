@@ -0,0 +1,1029 @@
+// generated with "makebitbase KPvK KPKBitbase.cpp"
+#include "Bitbase.hpp"
+
+const std::array<uint64_t, 4096> Bitbase::kpk_bits = {
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0c0c0fcfcULL, 0xfff8f8f8f8f8fcfcULL, 0xfff0f0f0f0f0f8fcULL, 0xffe0e0e0e0e0f4fcULL,
+	0xff8080808080ecfcULL, 0x030000000000dcfcULL, 0x030101010101bcfcULL, 0x0303030303037cfcULL,
+	0xc0c0c0c0c0c0fcfcULL, 0xf0f0f0f0f0f8fcfcULL, 0xe0e0e0e0e0f0fcfcULL, 0xc0c0c0c0c0e0fcfcULL,
+	0x808080808080fcfcULL, 0x000000000000fcfcULL, 0x010101010101fcfcULL, 0x030303030303fcfcULL,
+	0xe0e0e0e0e0fffcfcULL, 0xe0e0e0e0e0fffcfcULL, 0xc0c0c0c0c0fffcfcULL, 0x8080808080fffcfcULL,
+	0x0000000000fffcfcULL, 0x0101010101fffcfcULL, 0x0303030303fffcfcULL, 0x0707070707fffcfcULL,
+	0xf0f0f0f0fffffcfcULL, 0xe0e0e0e0fffffcfcULL, 0xc0c0c0c0fffffcfcULL, 0x80808080fffffcfcULL,
+	0x01010101fffffcfcULL, 0x03030303fffffcfcULL, 0x07070707fffffcfcULL, 0x0f0f0f0ffffffcfcULL,
+	0xf8f8f8fffffffcfcULL, 0xf0f0f0fffffffcfcULL, 0xe0e0e0fffffffcfcULL, 0xc1c1c1fffffffcfcULL,
+	0x838383fffffffcfcULL, 0x070707fffffffcfcULL, 0x0f0f0ffffffffcfcULL, 0x1f1f1ffffffffcfcULL,
+	0xfcfcfffffffffcfcULL, 0xf8f8fffffffffcfcULL, 0xf1f1fffffffffcfcULL, 0xe3e3fffffffffcfcULL,
+	0xc7c7fffffffffcfcULL, 0x8f8ffffffffffcfcULL, 0x1f1ffffffffffcfcULL, 0x3f3ffffffffffcfcULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0c0c0f8f8ULL, 0xfff8f8f8f8f8f8f8ULL, 0xfff0f0f0f0f0f8f8ULL, 0xffe1e1e1e1e1f0f8ULL,
+	0xffc1c1c1c1c1e8f8ULL, 0xff0101010101d8f8ULL, 0x070101010101b8f8ULL, 0x03030303030378f8ULL,
+	0xc0c0c0c0c0c0f8f8ULL, 0xf0f0f0f0f0f8f8f8ULL, 0xe0e0e0e0e0f1f8f8ULL, 0xc0c0c0c0c0e0f8f8ULL,
+	0x8181818181c1f8f8ULL, 0x010101010101f8f8ULL, 0x010101010101f8f8ULL, 0x030303030303f8f8ULL,
+	0xe0e0e0e0e0fff8f8ULL, 0xe0e0e0e0e0fff8f8ULL, 0xc0c0c0c0c0fff8f8ULL, 0x8080808080fff8f8ULL,
+	0x0000000000fff8f8ULL, 0x0101010101fff8f8ULL, 0x0303030303fff8f8ULL, 0x0707070707fff8f8ULL,
+	0xf0f0f0f0fffff8f8ULL, 0xe0e0e0e0fffff8f8ULL, 0xc0c0c0c0fffff8f8ULL, 0x80808080fffff8f8ULL,
+	0x01010101fffff8f8ULL, 0x03030303fffff8f8ULL, 0x07070707fffff8f8ULL, 0x0f0f0f0ffffff8f8ULL,
+	0xf8f8f8fffffff8f8ULL, 0xf0f0f0fffffff8f8ULL, 0xe0e0e0fffffff8f8ULL, 0xc1c1c1fffffff8f8ULL,
+	0x838383fffffff8f8ULL, 0x070707fffffff8f8ULL, 0x0f0f0ffffffff8f8ULL, 0x1f1f1ffffffff8f8ULL,
+	0xfcfcfffffffff8f8ULL, 0xf8f8fffffffff8f8ULL, 0xf1f1fffffffff8f8ULL, 0xe3e3fffffffff8f8ULL,
+	0xc7c7fffffffff8f8ULL, 0x8f8ffffffffff8f8ULL, 0x1f1ffffffffff8f8ULL, 0x3f3ffffffffff8f8ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0c0c0f0f1ULL, 0xfff0f0f0f0f0f1f1ULL, 0xfff1f1f1f1f1f1f1ULL, 0xffe1e1e1e1e1f1f1ULL,
+	0xffc3c3c3c3c3e1f1ULL, 0xff8383838383d1f1ULL, 0xff0303030303b1f1ULL, 0x03030303030371f1ULL,
+	0xc0c0c0c0c0c0f1f1ULL, 0xf0f0f0f0f0f8f1f1ULL, 0xe0e0e0e0e0f1f1f1ULL, 0xc1c1c1c1c1e3f1f1ULL,
+	0x8181818181c1f1f1ULL, 0x030303030383f1f1ULL, 0x030303030303f1f1ULL, 0x030303030303f1f1ULL,
+	0xe0e0e0e0e0fff1f1ULL, 0xe0e0e0e0e0fff1f1ULL, 0xc0c0c0c0c0fff1f1ULL, 0x8080808080fff1f1ULL,
+	0x0101010101fff1f1ULL, 0x0101010101fff1f1ULL, 0x0303030303fff1f1ULL, 0x0707070707fff1f1ULL,
+	0xf0f0f0f0fffff1f1ULL, 0xe0e0e0e0fffff1f1ULL, 0xc0c0c0c0fffff1f1ULL, 0x80808080fffff1f1ULL,
+	0x01010101fffff1f1ULL, 0x03030303fffff1f1ULL, 0x07070707fffff1f1ULL, 0x0f0f0f0ffffff1f1ULL,
+	0xf8f8f8fffffff1f1ULL, 0xf0f0f0fffffff1f1ULL, 0xe0e0e0fffffff1f1ULL, 0xc1c1c1fffffff1f1ULL,
+	0x838383fffffff1f1ULL, 0x070707fffffff1f1ULL, 0x0f0f0ffffffff1f1ULL, 0x1f1f1ffffffff1f1ULL,
+	0xfcfcfffffffff1f1ULL, 0xf8f8fffffffff1f1ULL, 0xf1f1fffffffff1f1ULL, 0xe3e3fffffffff1f1ULL,
+	0xc7c7fffffffff1f1ULL, 0x8f8ffffffffff1f1ULL, 0x1f1ffffffffff1f1ULL, 0x3f3ffffffffff1f1ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0c0c0e2e3ULL, 0xfff0f0f0f0f0e1e3ULL, 0xffe1e1e1e1e1e3e3ULL, 0xffe3e3e3e3e3e3e3ULL,
+	0xffc3c3c3c3c3e3e3ULL, 0xff8787878787c3e3ULL, 0xff0707070707a3e3ULL, 0x03030303030363e3ULL,
+	0xc0c0c0c0c0c0e3e3ULL, 0xe0e0e0e0e0e0e3e3ULL, 0xe0e0e0e0e0f1e3e3ULL, 0xc1c1c1c1c1e3e3e3ULL,
+	0x8383838383c7e3e3ULL, 0x030303030383e3e3ULL, 0x070707070707e3e3ULL, 0x030303030303e3e3ULL,
+	0xe0e0e0e0e0ffe3e3ULL, 0xe0e0e0e0e0ffe3e3ULL, 0xc0c0c0c0c0ffe3e3ULL, 0x8080808080ffe3e3ULL,
+	0x0101010101ffe3e3ULL, 0x0303030303ffe3e3ULL, 0x0303030303ffe3e3ULL, 0x0707070707ffe3e3ULL,
+	0xf0f0f0f0ffffe3e3ULL, 0xe0e0e0e0ffffe3e3ULL, 0xc0c0c0c0ffffe3e3ULL, 0x80808080ffffe3e3ULL,
+	0x01010101ffffe3e3ULL, 0x03030303ffffe3e3ULL, 0x07070707ffffe3e3ULL, 0x0f0f0f0fffffe3e3ULL,
+	0xf8f8f8ffffffe3e3ULL, 0xf0f0f0ffffffe3e3ULL, 0xe0e0e0ffffffe3e3ULL, 0xc1c1c1ffffffe3e3ULL,
+	0x838383ffffffe3e3ULL, 0x070707ffffffe3e3ULL, 0x0f0f0fffffffe3e3ULL, 0x1f1f1fffffffe3e3ULL,
+	0xfcfcffffffffe3e3ULL, 0xf8f8ffffffffe3e3ULL, 0xf1f1ffffffffe3e3ULL, 0xe3e3ffffffffe3e3ULL,
+	0xc7c7ffffffffe3e3ULL, 0x8f8fffffffffe3e3ULL, 0x1f1fffffffffe3e3ULL, 0x3f3fffffffffe3e3ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0xfffffcfffcf8fcfcULL, 0xfffff8fbf8f0f8fcULL, 0xffffe0e3e0e0f4fcULL,
+	0xff8380838080ecfcULL, 0x030300030000dcfcULL, 0x030301030100bcfcULL, 0x0303030303007cfcULL,
+	0xc0c0c0c0c0f8fcfcULL, 0xf8f8f8f8f8fcfcfcULL, 0xf0f0f0f0f0f8fcfcULL, 0xe0e0e0e0e0e0fcfcULL,
+	0x808080808080fcfcULL, 0x000000000000fcfcULL, 0x010101010100fcfcULL, 0x030303030300fcfcULL,
+	0xe0e0e0e0e0fcfcfcULL, 0xf0f0f0f0f8fcfcfcULL, 0xe0e0e0e0f0fcfcfcULL, 0xc0c0c0c0e0fcfcfcULL,
+	0x8080808080fcfcfcULL, 0x0101010101fcfcfcULL, 0x0303030303fcfcfcULL, 0x0707070707fcfcfcULL,
+	0xf0f0f0f0fffcfcfcULL, 0xe0e0e0e0fffcfcfcULL, 0xc0c0c0c0fffcfcfcULL, 0x80808080fffcfcfcULL,
+	0x01010101fffcfcfcULL, 0x03030303fffcfcfcULL, 0x07070707fffcfcfcULL, 0x0f0f0f0ffffcfcfcULL,
+	0xf8f8f8fffffcfcfcULL, 0xf0f0f0fffffcfcfcULL, 0xe0e0e0fffffcfcfcULL, 0xc1c1c1fffffcfcfcULL,
+	0x838383fffffcfcfcULL, 0x070707fffffcfcfcULL, 0x0f0f0ffffffcfcfcULL, 0x1f1f1ffffffcfcfcULL,
+	0xfcfcfffffffcfcfcULL, 0xf8f8fffffffcfcfcULL, 0xf1f1fffffffcfcfcULL, 0xe3e3fffffffcfcfcULL,
+	0xc7c7fffffffcfcfcULL, 0x8f8ffffffffcfcfcULL, 0x1f1ffffffffcfcfcULL, 0x3f3ffffffffcfcfcULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0c0f8f8f8ULL, 0x0000000000000000ULL, 0xfffff9fff9f0f8f8ULL, 0xfffff1f7f1e0f0f8ULL,
+	0xffffc1c7c1c0e8f8ULL, 0xff0701070100d8f8ULL, 0x070701070100b8f8ULL, 0x03030303030078f8ULL,
+	0xc0c0c0c0c0f8f8f8ULL, 0xf8f8f8f8f8f8f8f8ULL, 0xf0f0f0f0f0f8f8f8ULL, 0xe1e1e1e1e1f0f8f8ULL,
+	0xc1c1c1c1c1c0f8f8ULL, 0x010101010100f8f8ULL, 0x010101010100f8f8ULL, 0x030303030300f8f8ULL,
+	0xe0e0e0e0e0f8f8f8ULL, 0xf0f0f0f0f8f8f8f8ULL, 0xe0e0e0e0f1f8f8f8ULL, 0xc0c0c0c0e0f8f8f8ULL,
+	0x81818181c1f8f8f8ULL, 0x0101010101f8f8f8ULL, 0x0303030303f8f8f8ULL, 0x0707070707f8f8f8ULL,
+	0xf0f0f0f0fff8f8f8ULL, 0xe0e0e0e0fff8f8f8ULL, 0xc0c0c0c0fff8f8f8ULL, 0x80808080fff8f8f8ULL,
+	0x01010101fff8f8f8ULL, 0x03030303fff8f8f8ULL, 0x07070707fff8f8f8ULL, 0x0f0f0f0ffff8f8f8ULL,
+	0xf8f8f8fffff8f8f8ULL, 0xf0f0f0fffff8f8f8ULL, 0xe0e0e0fffff8f8f8ULL, 0xc1c1c1fffff8f8f8ULL,
+	0x838383fffff8f8f8ULL, 0x070707fffff8f8f8ULL, 0x0f0f0ffffff8f8f8ULL, 0x1f1f1ffffff8f8f8ULL,
+	0xfcfcfffffff8f8f8ULL, 0xf8f8fffffff8f8f8ULL, 0xf1f1fffffff8f8f8ULL, 0xe3e3fffffff8f8f8ULL,
+	0xc7c7fffffff8f8f8ULL, 0x8f8ffffffff8f8f8ULL, 0x1f1ffffffff8f8f8ULL, 0x3f3ffffffff8f8f8ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0c0f0f0f1ULL, 0xfffff9fff9f0f1f1ULL, 0x0000000000000000ULL, 0xfffff3fff3e1f1f1ULL,
+	0xffffe3efe3c1e1f1ULL, 0xffff838f8381d1f1ULL, 0xff0f030f0301b1f1ULL, 0x03030303030171f1ULL,
+	0xc0c0c0c0c0f0f1f1ULL, 0xf0f0f0f0f0f1f1f1ULL, 0xf1f1f1f1f1f1f1f1ULL, 0xe1e1e1e1e1f1f1f1ULL,
+	0xc3c3c3c3c3e1f1f1ULL, 0x838383838381f1f1ULL, 0x030303030301f1f1ULL, 0x030303030301f1f1ULL,
+	0xe0e0e0e0e0f1f1f1ULL, 0xf0f0f0f0f8f1f1f1ULL, 0xe0e0e0e0f1f1f1f1ULL, 0xc1c1c1c1e3f1f1f1ULL,
+	0x81818181c1f1f1f1ULL, 0x0303030383f1f1f1ULL, 0x0303030303f1f1f1ULL, 0x0707070707f1f1f1ULL,
+	0xf0f0f0f0fff1f1f1ULL, 0xe0e0e0e0fff1f1f1ULL, 0xc0c0c0c0fff1f1f1ULL, 0x80808080fff1f1f1ULL,
+	0x01010101fff1f1f1ULL, 0x03030303fff1f1f1ULL, 0x07070707fff1f1f1ULL, 0x0f0f0f0ffff1f1f1ULL,
+	0xf8f8f8fffff1f1f1ULL, 0xf0f0f0fffff1f1f1ULL, 0xe0e0e0fffff1f1f1ULL, 0xc1c1c1fffff1f1f1ULL,
+	0x838383fffff1f1f1ULL, 0x070707fffff1f1f1ULL, 0x0f0f0ffffff1f1f1ULL, 0x1f1f1ffffff1f1f1ULL,
+	0xfcfcfffffff1f1f1ULL, 0xf8f8fffffff1f1f1ULL, 0xf1f1fffffff1f1f1ULL, 0xe3e3fffffff1f1f1ULL,
+	0xc7c7fffffff1f1f1ULL, 0x8f8ffffffff1f1f1ULL, 0x1f1ffffffff1f1f1ULL, 0x3f3ffffffff1f1f1ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0c0e0e2e3ULL, 0xfffff1fdf1e0e1e3ULL, 0xfffff3fff3e1e3e3ULL, 0x0000000000000000ULL,
+	0xffffe7ffe7c3e3e3ULL, 0xffffc7dfc783c3e3ULL, 0xffff071f0703a3e3ULL, 0x03030303030363e3ULL,
+	0xc0c0c0c0c0e0e3e3ULL, 0xf0f0f0f0f0e1e3e3ULL, 0xe1e1e1e1e1e3e3e3ULL, 0xe3e3e3e3e3e3e3e3ULL,
+	0xc3c3c3c3c3e3e3e3ULL, 0x8787878787c3e3e3ULL, 0x070707070703e3e3ULL, 0x030303030303e3e3ULL,
+	0xe0e0e0e0e0e3e3e3ULL, 0xe0e0e0e0e0e3e3e3ULL, 0xe0e0e0e0f1e3e3e3ULL, 0xc1c1c1c1e3e3e3e3ULL,
+	0x83838383c7e3e3e3ULL, 0x0303030383e3e3e3ULL, 0x0707070707e3e3e3ULL, 0x0707070707e3e3e3ULL,
+	0xf0f0f0f0ffe3e3e3ULL, 0xe0e0e0e0ffe3e3e3ULL, 0xc0c0c0c0ffe3e3e3ULL, 0x80808080ffe3e3e3ULL,
+	0x01010101ffe3e3e3ULL, 0x03030303ffe3e3e3ULL, 0x07070707ffe3e3e3ULL, 0x0f0f0f0fffe3e3e3ULL,
+	0xf8f8f8ffffe3e3e3ULL, 0xf0f0f0ffffe3e3e3ULL, 0xe0e0e0ffffe3e3e3ULL, 0xc1c1c1ffffe3e3e3ULL,
+	0x838383ffffe3e3e3ULL, 0x070707ffffe3e3e3ULL, 0x0f0f0fffffe3e3e3ULL, 0x1f1f1fffffe3e3e3ULL,
+	0xfcfcffffffe3e3e3ULL, 0xf8f8ffffffe3e3e3ULL, 0xf1f1ffffffe3e3e3ULL, 0xe3e3ffffffe3e3e3ULL,
+	0xc7c7ffffffe3e3e3ULL, 0x8f8fffffffe3e3e3ULL, 0x1f1fffffffe3e3e3ULL, 0x3f3fffffffe3e3e3ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0f8f8fcffULL, 0xfffffffefcf8fcffULL, 0xfffffffaf8f0f8ffULL, 0xffffe3e2e0e0f4ffULL,
+	0xff8383828080ecffULL, 0x030303020000dcffULL, 0x030303030000bcffULL, 0x0303030300007cffULL,
+	0x0000000000000000ULL, 0xfffcfffcf8fcfcffULL, 0xfff8fbf8f0f8fcffULL, 0xffe0e3e0e0e0fcffULL,
+	0x838083808080fcffULL, 0x030003000000fcffULL, 0x030103010000fcffULL, 0x030303030000fcffULL,
+	0xe0e0e0e0f8fcfcffULL, 0xf8f8f8f8fcfcfcffULL, 0xf0f0f0f0f8fcfcffULL, 0xe0e0e0e0e0fcfcffULL,
+	0x8080808080fcfcffULL, 0x0101010100fcfcffULL, 0x0303030300fcfcffULL, 0x0707070704fcfcffULL,
+	0xf0f0f0f0fcfcfcffULL, 0xf0f0f0f8fcfcfcffULL, 0xe0e0e0f0fcfcfcffULL, 0xc0c0c0e0fcfcfcffULL,
+	0x81818181fcfcfcffULL, 0x03030303fcfcfcffULL, 0x07070707fcfcfcffULL, 0x0f0f0f0ffcfcfcffULL,
+	0xf8f8f8fffcfcfcffULL, 0xf0f0f0fffcfcfcffULL, 0xe0e0e0fffcfcfcffULL, 0xc1c1c1fffcfcfcffULL,
+	0x838383fffcfcfcffULL, 0x070707fffcfcfcffULL, 0x0f0f0ffffcfcfcffULL, 0x1f1f1ffffcfcfcffULL,
+	0xfcfcfffffcfcfcffULL, 0xf8f8fffffcfcfcffULL, 0xf1f1fffffcfcfcffULL, 0xe3e3fffffcfcfcffULL,
+	0xc7c7fffffcfcfcffULL, 0x8f8ffffffcfcfcffULL, 0x1f1ffffffcfcfcffULL, 0x3f3ffffffcfcfcffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0f8f8f8ffULL, 0xfffffffdf8f8f8ffULL, 0xfffffffdf8f0f8ffULL, 0xfffffff5f0e0f0ffULL,
+	0xffffc7c5c0c0e8ffULL, 0xff0707050000d8ffULL, 0x070707050000b8ffULL, 0x03030303000078ffULL,
+	0xc0c0c0c0f8f8f8ffULL, 0x0000000000000000ULL, 0xfff9fff9f0f8f8ffULL, 0xfff1f7f1e0f0f8ffULL,
+	0xffc1c7c1c0c0f8ffULL, 0x070107010000f8ffULL, 0x070107010000f8ffULL, 0x030303030000f8ffULL,
+	0xe0e0e0e0f8f8f8ffULL, 0xf8f8f8f8f8f8f8ffULL, 0xf0f0f0f0f8f8f8ffULL, 0xe1e1e1e1f0f8f8ffULL,
+	0xc1c1c1c1c0f8f8ffULL, 0x0101010100f8f8ffULL, 0x0303030300f8f8ffULL, 0x0707070700f8f8ffULL,
+	0xf0f0f0f0f8f8f8ffULL, 0xf0f0f0f8f8f8f8ffULL, 0xe0e0e0f1f8f8f8ffULL, 0xc0c0c0e0f8f8f8ffULL,
+	0x818181c1f8f8f8ffULL, 0x03030303f8f8f8ffULL, 0x07070707f8f8f8ffULL, 0x0f0f0f0ff8f8f8ffULL,
+	0xf8f8f8fff8f8f8ffULL, 0xf0f0f0fff8f8f8ffULL, 0xe0e0e0fff8f8f8ffULL, 0xc1c1c1fff8f8f8ffULL,
+	0x838383fff8f8f8ffULL, 0x070707fff8f8f8ffULL, 0x0f0f0ffff8f8f8ffULL, 0x1f1f1ffff8f8f8ffULL,
+	0xfcfcfffff8f8f8ffULL, 0xf8f8fffff8f8f8ffULL, 0xf1f1fffff8f8f8ffULL, 0xe3e3fffff8f8f8ffULL,
+	0xc7c7fffff8f8f8ffULL, 0x8f8ffffff8f8f8ffULL, 0x1f1ffffff8f8f8ffULL, 0x3f3ffffff8f8f8ffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0f0f0f0ffULL, 0xfffffffbf1f0f1ffULL, 0xfffffffbf1f1f1ffULL, 0xfffffffbf1e1f1ffULL,
+	0xffffffebe1c1e1ffULL, 0xffff8f8b8181d1ffULL, 0xff0f0f0b0101b1ffULL, 0x03030303010171ffULL,
+	0xc0c0c0c0f0f0f1ffULL, 0xfff9fff9f0f1f1ffULL, 0x0000000000000000ULL, 0xfff3fff3e1f1f1ffULL,
+	0xffe3efe3c1e1f1ffULL, 0xff838f838181f1ffULL, 0x0f030f030101f1ffULL, 0x030303030101f1ffULL,
+	0xe0e0e0e0f0f1f1ffULL, 0xf0f0f0f0f1f1f1ffULL, 0xf1f1f1f1f1f1f1ffULL, 0xe1e1e1e1f1f1f1ffULL,
+	0xc3c3c3c3e1f1f1ffULL, 0x8383838381f1f1ffULL, 0x0303030301f1f1ffULL, 0x0707070701f1f1ffULL,
+	0xf0f0f0f0f1f1f1ffULL, 0xf0f0f0f8f1f1f1ffULL, 0xe0e0e0f1f1f1f1ffULL, 0xc1c1c1e3f1f1f1ffULL,
+	0x818181c1f1f1f1ffULL, 0x03030383f1f1f1ffULL, 0x07070707f1f1f1ffULL, 0x0f0f0f0ff1f1f1ffULL,
+	0xf8f8f8fff1f1f1ffULL, 0xf0f0f0fff1f1f1ffULL, 0xe0e0e0fff1f1f1ffULL, 0xc1c1c1fff1f1f1ffULL,
+	0x838383fff1f1f1ffULL, 0x070707fff1f1f1ffULL, 0x0f0f0ffff1f1f1ffULL, 0x1f1f1ffff1f1f1ffULL,
+	0xfcfcfffff1f1f1ffULL, 0xf8f8fffff1f1f1ffULL, 0xf1f1fffff1f1f1ffULL, 0xe3e3fffff1f1f1ffULL,
+	0xc7c7fffff1f1f1ffULL, 0x8f8ffffff1f1f1ffULL, 0x1f1ffffff1f1f1ffULL, 0x3f3ffffff1f1f1ffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0e0e0e2ffULL, 0xfffffff5e1e0e1ffULL, 0xfffffff7e3e1e3ffULL, 0xfffffff7e3e3e3ffULL,
+	0xfffffff7e3c3e3ffULL, 0xffffffd7c383c3ffULL, 0xffff1f170303a3ffULL, 0x03030303030363ffULL,
+	0xc0c0c0c0e0e0e3ffULL, 0xfff1fdf1e0e1e3ffULL, 0xfff3fff3e1e3e3ffULL, 0x0000000000000000ULL,
+	0xffe7ffe7c3e3e3ffULL, 0xffc7dfc783c3e3ffULL, 0xff071f070303e3ffULL, 0x030303030303e3ffULL,
+	0xe0e0e0e0e0e3e3ffULL, 0xf0f0f0f0e1e3e3ffULL, 0xe1e1e1e1e3e3e3ffULL, 0xe3e3e3e3e3e3e3ffULL,
+	0xc3c3c3c3e3e3e3ffULL, 0x87878787c3e3e3ffULL, 0x0707070703e3e3ffULL, 0x0707070703e3e3ffULL,
+	0xf0f0f0f0e3e3e3ffULL, 0xe0e0e0e0e3e3e3ffULL, 0xe0e0e0f1e3e3e3ffULL, 0xc1c1c1e3e3e3e3ffULL,
+	0x838383c7e3e3e3ffULL, 0x03030383e3e3e3ffULL, 0x07070707e3e3e3ffULL, 0x0f0f0f0fe3e3e3ffULL,
+	0xf8f8f8ffe3e3e3ffULL, 0xf0f0f0ffe3e3e3ffULL, 0xe0e0e0ffe3e3e3ffULL, 0xc1c1c1ffe3e3e3ffULL,
+	0x838383ffe3e3e3ffULL, 0x070707ffe3e3e3ffULL, 0x0f0f0fffe3e3e3ffULL, 0x1f1f1fffe3e3e3ffULL,
+	0xfcfcffffe3e3e3ffULL, 0xf8f8ffffe3e3e3ffULL, 0xf1f1ffffe3e3e3ffULL, 0xe3e3ffffe3e3e3ffULL,
+	0xc7c7ffffe3e3e3ffULL, 0x8f8fffffe3e3e3ffULL, 0x1f1fffffe3e3e3ffULL, 0x3f3fffffe3e3e3ffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xe0e0e0f8f8fcfeffULL, 0xfffffffcfcf8fdffULL, 0xfffffff8f8f0fbffULL, 0xffffe3e0e0e0f7ffULL,
+	0xff8383808080efffULL, 0x030303000000dfffULL, 0x030303000000bfffULL, 0x0303030000007fffULL,
+	0xe0e0e0f8f8fcffffULL, 0xfffffefcf8fcffffULL, 0xfffffaf8f0f8ffffULL, 0xffe3e2e0e0e0ffffULL,
+	0x838382808080ffffULL, 0x030302000000ffffULL, 0x030303000000ffffULL, 0x030303000000ffffULL,
+	0x0000000000000000ULL, 0xfcfffcf8fcfcffffULL, 0xf8fbf8f0f8fcffffULL, 0xe0e3e0e0e0fcffffULL,
+	0x8083808080fcffffULL, 0x0103010000fcffffULL, 0x0303030000fcffffULL, 0x0707070404fcffffULL,
+	0xf0f0f0f8fcfcffffULL, 0xf8f8f8fcfcfcffffULL, 0xf0f0f0f8fcfcffffULL, 0xe1e1e0e0fcfcffffULL,
+	0x81818180fcfcffffULL, 0x03030300fcfcffffULL, 0x07070704fcfcffffULL, 0x0f0f0f0cfcfcffffULL,
+	0xf8f8f8fcfcfcffffULL, 0xf8f8f8fcfcfcffffULL, 0xf1f1f0fcfcfcffffULL, 0xe3e3e1fcfcfcffffULL,
+	0x838383fcfcfcffffULL, 0x070707fcfcfcffffULL, 0x0f0f0ffcfcfcffffULL, 0x1f1f1ffcfcfcffffULL,
+	0xfcfcfffcfcfcffffULL, 0xf8f8fffcfcfcffffULL, 0xf1f1fffcfcfcffffULL, 0xe3e3fffcfcfcffffULL,
+	0xc7c7fffcfcfcffffULL, 0x8f8ffffcfcfcffffULL, 0x1f1ffffcfcfcffffULL, 0x3f3ffffcfcfcffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xe0e0e0f8f8f8feffULL, 0xfffffff8f8f8fdffULL, 0xfffffff8f8f0fbffULL, 0xfffffff0f0e0f7ffULL,
+	0xffffc7c0c0c0efffULL, 0xff0707000000dfffULL, 0x070707000000bfffULL, 0x0303030000007fffULL,
+	0xe0e0e0f8f8f8ffffULL, 0xfffffdf8f8f8ffffULL, 0xfffffdf8f0f8ffffULL, 0xfffff5f0e0f0ffffULL,
+	0xffc7c5c0c0c0ffffULL, 0x070705000000ffffULL, 0x070705000000ffffULL, 0x030303000000ffffULL,
+	0xe0e0e0f8f8f8ffffULL, 0x0000000000000000ULL, 0xf9fff9f0f8f8ffffULL, 0xf1f7f1e0f0f8ffffULL,
+	0xc1c7c1c0c0f8ffffULL, 0x0107010000f8ffffULL, 0x0307030000f8ffffULL, 0x0707070000f8ffffULL,
+	0xf0f0f0f8f8f8ffffULL, 0xf8f8f8f8f8f8ffffULL, 0xf0f0f0f8f8f8ffffULL, 0xe1e1e1f0f8f8ffffULL,
+	0xc3c3c1c0f8f8ffffULL, 0x03030300f8f8ffffULL, 0x07070700f8f8ffffULL, 0x0f0f0f08f8f8ffffULL,
+	0xf8f8f8f8f8f8ffffULL, 0xf8f8f8f8f8f8ffffULL, 0xf1f1f1f8f8f8ffffULL, 0xe3e3e1f8f8f8ffffULL,
+	0xc7c7c3f8f8f8ffffULL, 0x070707f8f8f8ffffULL, 0x0f0f0ff8f8f8ffffULL, 0x1f1f1ff8f8f8ffffULL,
+	0xfcfcfff8f8f8ffffULL, 0xf8f8fff8f8f8ffffULL, 0xf1f1fff8f8f8ffffULL, 0xe3e3fff8f8f8ffffULL,
+	0xc7c7fff8f8f8ffffULL, 0x8f8ffff8f8f8ffffULL, 0x1f1ffff8f8f8ffffULL, 0x3f3ffff8f8f8ffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xe0e0e0f0f0f0feffULL, 0xfffffff1f1f0fdffULL, 0xfffffff1f1f1fbffULL, 0xfffffff1f1e1f7ffULL,
+	0xffffffe1e1c1efffULL, 0xffff8f818181dfffULL, 0xff0f0f010101bfffULL, 0x0303030101017fffULL,
+	0xe0e0e0f0f0f0ffffULL, 0xfffffbf1f0f1ffffULL, 0xfffffbf1f1f1ffffULL, 0xfffffbf1e1f1ffffULL,
+	0xffffebe1c1e1ffffULL, 0xff8f8b818181ffffULL, 0x0f0f0b010101ffffULL, 0x030303010101ffffULL,
+	0xe0e0e0f0f0f1ffffULL, 0xf9fff9f0f1f1ffffULL, 0x0000000000000000ULL, 0xf3fff3e1f1f1ffffULL,
+	0xe3efe3c1e1f1ffffULL, 0x838f838181f1ffffULL, 0x030f030101f1ffffULL, 0x0707070101f1ffffULL,
+	0xf0f0f0f0f1f1ffffULL, 0xf0f0f0f1f1f1ffffULL, 0xf1f1f1f1f1f1ffffULL, 0xe1e1e1f1f1f1ffffULL,
+	0xc3c3c3e1f1f1ffffULL, 0x87878381f1f1ffffULL, 0x07070701f1f1ffffULL, 0x0f0f0f01f1f1ffffULL,
+	0xf8f8f8f1f1f1ffffULL, 0xf8f8f8f1f1f1ffffULL, 0xf1f1f1f1f1f1ffffULL, 0xe3e3e3f1f1f1ffffULL,
+	0xc7c7c3f1f1f1ffffULL, 0x8f8f87f1f1f1ffffULL, 0x0f0f0ff1f1f1ffffULL, 0x1f1f1ff1f1f1ffffULL,
+	0xfcfcfff1f1f1ffffULL, 0xf8f8fff1f1f1ffffULL, 0xf1f1fff1f1f1ffffULL, 0xe3e3fff1f1f1ffffULL,
+	0xc7c7fff1f1f1ffffULL, 0x8f8ffff1f1f1ffffULL, 0x1f1ffff1f1f1ffffULL, 0x3f3ffff1f1f1ffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xe0e0e0e0e0e0feffULL, 0xffffffe1e1e0fdffULL, 0xffffffe3e3e1fbffULL, 0xffffffe3e3e3f7ffULL,
+	0xffffffe3e3c3efffULL, 0xffffffc3c383dfffULL, 0xffff1f030303bfffULL, 0x0707070303037fffULL,
+	0xe0e0e0e0e0e0ffffULL, 0xfffff5e1e0e1ffffULL, 0xfffff7e3e1e3ffffULL, 0xfffff7e3e3e3ffffULL,
+	0xfffff7e3c3e3ffffULL, 0xffffd7c383c3ffffULL, 0xff1f17030303ffffULL, 0x070707030303ffffULL,
+	0xe0e0e0e0e0e3ffffULL, 0xf1fdf1e0e1e3ffffULL, 0xf3fff3e1e3e3ffffULL, 0x0000000000000000ULL,
+	0xe7ffe7c3e3e3ffffULL, 0xc7dfc783c3e3ffffULL, 0x071f070303e3ffffULL, 0x0707070303e3ffffULL,
+	0xf0f0f0e0e3e3ffffULL, 0xf0f0f0e1e3e3ffffULL, 0xe1e1e1e3e3e3ffffULL, 0xe3e3e3e3e3e3ffffULL,
+	0xc3c3c3e3e3e3ffffULL, 0x878787c3e3e3ffffULL, 0x0f0f0703e3e3ffffULL, 0x0f0f0f03e3e3ffffULL,
+	0xf8f8f8e3e3e3ffffULL, 0xf8f8f0e3e3e3ffffULL, 0xf1f1f1e3e3e3ffffULL, 0xe3e3e3e3e3e3ffffULL,
+	0xc7c7c7e3e3e3ffffULL, 0x8f8f87e3e3e3ffffULL, 0x1f1f0fe3e3e3ffffULL, 0x1f1f1fe3e3e3ffffULL,
+	0xfcfcffe3e3e3ffffULL, 0xf8f8ffe3e3e3ffffULL, 0xf1f1ffe3e3e3ffffULL, 0xe3e3ffe3e3e3ffffULL,
+	0xc7c7ffe3e3e3ffffULL, 0x8f8fffe3e3e3ffffULL, 0x1f1fffe3e3e3ffffULL, 0x3f3fffe3e3e3ffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0f0f8f8f8fcfeffULL, 0xfffffcfcfcf8fdffULL, 0xfffffcf8f8f1fbffULL, 0xffffe0e0e0e3f7ffULL,
+	0xff8380808083efffULL, 0x030300000003dfffULL, 0x030300000003bfffULL, 0x0303000000037fffULL,
+	0xf0f0f8f8f8feffffULL, 0xfffffcfcf8fdffffULL, 0xfffff8f8f0f9ffffULL, 0xffe3e0e0e0e1ffffULL,
+	0x838380808081ffffULL, 0x030300000001ffffULL, 0x030300000001ffffULL, 0x030300000003ffffULL,
+	0xf0f0f8f8fcffffffULL, 0xfffefcf8fcffffffULL, 0xfffaf8f0f8ffffffULL, 0xe3e2e0e0e0ffffffULL,
+	0x8382808080ffffffULL, 0x0303000000ffffffULL, 0x0303000000ffffffULL, 0x0707040404ffffffULL,
+	0x0000000000000000ULL, 0xfffcf8fcfcffffffULL, 0xfff9f0f8fcffffffULL, 0xe3e1e0e0fcffffffULL,
+	0x83818080fcffffffULL, 0x03030000fcffffffULL, 0x07070404fcffffffULL, 0x0f0f0c0cfcffffffULL,
+	0xf8f8f8fcfcffffffULL, 0xfdf8fcfcfcffffffULL, 0xfbf1f8fcfcffffffULL, 0xe3e3e0fcfcffffffULL,
+	0x838380fcfcffffffULL, 0x070704fcfcffffffULL, 0x0f0f0cfcfcffffffULL, 0x1f1f1cfcfcffffffULL,
+	0xfcfcfcfcfcffffffULL, 0xfaf8fcfcfcffffffULL, 0xf5f1fcfcfcffffffULL, 0xe3e3fcfcfcffffffULL,
+	0xc7c7fcfcfcffffffULL, 0x8f8ffcfcfcffffffULL, 0x1f1ffcfcfcffffffULL, 0x3f3ffcfcfcffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0f0f8f8f8fcfeffULL, 0xfffff8f8f8f8fdffULL, 0xfffff8f8f8f1fbffULL, 0xfffff8f0f0e3f7ffULL,
+	0xffffc0c0c0c7efffULL, 0xff0700000007dfffULL, 0x070700000007bfffULL, 0x0303000000077fffULL,
+	0xf0f0f8f8f8feffffULL, 0xfffff8f8f8fdffffULL, 0xfffff8f8f0fbffffULL, 0xfffff0f0e0f3ffffULL,
+	0xffc7c0c0c0c3ffffULL, 0x070700000003ffffULL, 0x070700000003ffffULL, 0x030300000003ffffULL,
+	0xf0f0f8f8f8ffffffULL, 0xfffdf8f8f8ffffffULL, 0xfffdf8f0f8ffffffULL, 0xfff5f0e0f0ffffffULL,
+	0xc7c5c0c0c0ffffffULL, 0x0705000000ffffffULL, 0x0707000000ffffffULL, 0x0707000000ffffffULL,
+	0xf0f0f8f8f8ffffffULL, 0x0000000000000000ULL, 0xfff9f0f8f8ffffffULL, 0xfff3e0f0f8ffffffULL,
+	0xc7c3c0c0f8ffffffULL, 0x07030000f8ffffffULL, 0x07070000f8ffffffULL, 0x0f0f0808f8ffffffULL,
+	0xf8f8f8f8f8ffffffULL, 0xfdf8f8f8f8ffffffULL, 0xfbf1f8f8f8ffffffULL, 0xf7e3f0f8f8ffffffULL,
+	0xc7c7c0f8f8ffffffULL, 0x070700f8f8ffffffULL, 0x0f0f08f8f8ffffffULL, 0x1f1f18f8f8ffffffULL,
+	0xfcfcf8f8f8ffffffULL, 0xfaf8f8f8f8ffffffULL, 0xf5f1f8f8f8ffffffULL, 0xebe3f8f8f8ffffffULL,
+	0xc7c7f8f8f8ffffffULL, 0x8f8ff8f8f8ffffffULL, 0x1f1ff8f8f8ffffffULL, 0x3f3ff8f8f8ffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0f0f0f0f0fcfeffULL, 0xfffff1f1f1f8fdffULL, 0xfffff1f1f1f1fbffULL, 0xfffff1f1f1e3f7ffULL,
+	0xfffff1e1e1c7efffULL, 0xffff8181818fdfffULL, 0xff0f0101010fbfffULL, 0x03030101010f7fffULL,
+	0xf0f0f0f0f0fcffffULL, 0xfffff1f1f0fdffffULL, 0xfffff1f1f1fbffffULL, 0xfffff1f1e1f7ffffULL,
+	0xffffe1e1c1e7ffffULL, 0xff8f81818187ffffULL, 0x0f0f01010107ffffULL, 0x030301010107ffffULL,
+	0xf0f0f0f0f0ffffffULL, 0xfffbf1f0f1ffffffULL, 0xfffbf1f1f1ffffffULL, 0xfffbf1e1f1ffffffULL,
+	0xffebe1c1e1ffffffULL, 0x8f8b818181ffffffULL, 0x0f0b010101ffffffULL, 0x0707010101ffffffULL,
+	0xf0f0f0f0f1ffffffULL, 0xfff9f0f1f1ffffffULL, 0x0000000000000000ULL, 0xfff3e1f1f1ffffffULL,
+	0xffe7c1e1f1ffffffULL, 0x8f878181f1ffffffULL, 0x0f070101f1ffffffULL, 0x0f0f0101f1ffffffULL,
+	0xf8f8f0f1f1ffffffULL, 0xfdf8f1f1f1ffffffULL, 0xfbf1f1f1f1ffffffULL, 0xf7e3f1f1f1ffffffULL,
+	0xefc7e1f1f1ffffffULL, 0x8f8f81f1f1ffffffULL, 0x0f0f01f1f1ffffffULL, 0x1f1f11f1f1ffffffULL,
+	0xfcfcf1f1f1ffffffULL, 0xfaf8f1f1f1ffffffULL, 0xf5f1f1f1f1ffffffULL, 0xebe3f1f1f1ffffffULL,
+	0xd7c7f1f1f1ffffffULL, 0x8f8ff1f1f1ffffffULL, 0x1f1ff1f1f1ffffffULL, 0x3f3ff1f1f1ffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0f0e0e0e0fcfeffULL, 0xffffe3e1e1f8fdffULL, 0xffffe3e3e3f1fbffULL, 0xffffe3e3e3e3f7ffULL,
+	0xffffe3e3e3c7efffULL, 0xffffe3c3c38fdfffULL, 0xffff0303031fbfffULL, 0x07070303031f7fffULL,
+	0xf0f0e0e0e0f8ffffULL, 0xffffe1e1e0f9ffffULL, 0xffffe3e3e1fbffffULL, 0xffffe3e3e3f7ffffULL,
+	0xffffe3e3c3efffffULL, 0xffffc3c383cfffffULL, 0xff1f0303030fffffULL, 0x07070303030fffffULL,
+	0xf0f0e0e0e0ffffffULL, 0xfff5e1e0e1ffffffULL, 0xfff7e3e1e3ffffffULL, 0xfff7e3e3e3ffffffULL,
+	0xfff7e3c3e3ffffffULL, 0xffd7c383c3ffffffULL, 0x1f17030303ffffffULL, 0x0707030303ffffffULL,
+	0xf0f0e0e0e3ffffffULL, 0xfff9e0e1e3ffffffULL, 0xfff3e1e3e3ffffffULL, 0x0000000000000000ULL,
+	0xffe7c3e3e3ffffffULL, 0xffcf83c3e3ffffffULL, 0x1f0f0303e3ffffffULL, 0x0f0f0303e3ffffffULL,
+	0xf8f8e0e3e3ffffffULL, 0xfdf8e1e3e3ffffffULL, 0xfbf1e3e3e3ffffffULL, 0xf7e3e3e3e3ffffffULL,
+	0xefc7e3e3e3ffffffULL, 0xdf8fc3e3e3ffffffULL, 0x1f1f03e3e3ffffffULL, 0x1f1f03e3e3ffffffULL,
+	0xfcfce3e3e3ffffffULL, 0xfaf8e3e3e3ffffffULL, 0xf5f1e3e3e3ffffffULL, 0xebe3e3e3e3ffffffULL,
+	0xd7c7e3e3e3ffffffULL, 0xaf8fe3e3e3ffffffULL, 0x1f1fe3e3e3ffffffULL, 0x3f3fe3e3e3ffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf8f8f8f8f8fcfeffULL, 0xfffcfcfcf8f8fdffULL, 0xfffcf8f8f0f1fbffULL, 0xfffce0e0e0e3f7ffULL,
+	0xff8080808083efffULL, 0x030000000003dfffULL, 0x030000000103bfffULL, 0x0300000003037fffULL,
+	0xf8f8f8f8f8fcffffULL, 0xfffcfcfcf8f8ffffULL, 0xfffcf8f8f0f1ffffULL, 0xffe0e0e0e0e1ffffULL,
+	0x838080808081ffffULL, 0x030000000001ffffULL, 0x030000000101ffffULL, 0x030000000303ffffULL,
+	0xf8f8f8f8feffffffULL, 0xfffcfcf8fdffffffULL, 0xfff8f8f0f9ffffffULL, 0xe3e0e0e0e1ffffffULL,
+	0x8380808081ffffffULL, 0x0300000001ffffffULL, 0x0300000003ffffffULL, 0x0704040407ffffffULL,
+	0xf8f8f8fcffffffffULL, 0xfffcf8fcffffffffULL, 0xfff8f0f8ffffffffULL, 0xe3e0e0e0ffffffffULL,
+	0x83808080ffffffffULL, 0x03000000ffffffffULL, 0x07040404ffffffffULL, 0x0f0c0c0cffffffffULL,
+	0x0000000000000000ULL, 0xfef8fcfcffffffffULL, 0xfbf0f8fcffffffffULL, 0xe3e0e0fcffffffffULL,
+	0x838080fcffffffffULL, 0x070404fcffffffffULL, 0x0f0c0cfcffffffffULL, 0x1f1c1cfcffffffffULL,
+	0xfcfcfcfcffffffffULL, 0xf8fcfcfcffffffffULL, 0xf5f8fcfcffffffffULL, 0xe3e0fcfcffffffffULL,
+	0xc7c4fcfcffffffffULL, 0x8f8cfcfcffffffffULL, 0x1f1cfcfcffffffffULL, 0x3f3cfcfcffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf8f8f8f8fcfcfeffULL, 0xfff8f8f8f8f8fdffULL, 0xfff8f8f8f1f1fbffULL, 0xfff8f0f0e1e3f7ffULL,
+	0xfff8c0c0c1c7efffULL, 0xff0000000107dfffULL, 0x070000000107bfffULL, 0x0300000003077fffULL,
+	0xf8f8f8f8fcfcffffULL, 0xfff8f8f8f8f8ffffULL, 0xfff8f8f8f1f1ffffULL, 0xfff8f0f0e1e3ffffULL,
+	0xffc0c0c0c1c3ffffULL, 0x070000000103ffffULL, 0x070000000103ffffULL, 0x030000000303ffffULL,
+	0xf8f8f8f8feffffffULL, 0xfff8f8f8fdffffffULL, 0xfff8f8f0fbffffffULL, 0xfff0f0e0f3ffffffULL,
+	0xc7c0c0c0c3ffffffULL, 0x0700000003ffffffULL, 0x0700000003ffffffULL, 0x0700000007ffffffULL,
+	0xf8f8f8f8ffffffffULL, 0xfff8f8f8ffffffffULL, 0xfff8f0f8ffffffffULL, 0xfff0e0f0ffffffffULL,
+	0xc7c0c0c0ffffffffULL, 0x07000000ffffffffULL, 0x07000000ffffffffULL, 0x0f080808ffffffffULL,
+	0xfcf8f8f8ffffffffULL, 0x0000000000000000ULL, 0xfdf0f8f8ffffffffULL, 0xf7e0f0f8ffffffffULL,
+	0xc7c0c0f8ffffffffULL, 0x070000f8ffffffffULL, 0x0f0808f8ffffffffULL, 0x1f1818f8ffffffffULL,
+	0xfcf8f8f8ffffffffULL, 0xfaf8f8f8ffffffffULL, 0xf1f8f8f8ffffffffULL, 0xebf0f8f8ffffffffULL,
+	0xc7c0f8f8ffffffffULL, 0x8f88f8f8ffffffffULL, 0x1f18f8f8ffffffffULL, 0x3f38f8f8ffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf8f0f0f0f8fcfeffULL, 0xfff1f1f1f8f8fdffULL, 0xfff1f1f1f1f1fbffULL, 0xfff1f1f1e3e3f7ffULL,
+	0xfff1e1e1c3c7efffULL, 0xfff18181838fdfffULL, 0xff010101030fbfffULL, 0x03010101030f7fffULL,
+	0xf8f0f0f0f8fcffffULL, 0xfff1f1f1f8f8ffffULL, 0xfff1f1f1f1f1ffffULL, 0xfff1f1f1e3e3ffffULL,
+	0xfff1e1e1c3c7ffffULL, 0xff8181818387ffffULL, 0x0f0101010307ffffULL, 0x030101010307ffffULL,
+	0xf8f0f0f0fcffffffULL, 0xfff1f1f0fdffffffULL, 0xfff1f1f1fbffffffULL, 0xfff1f1e1f7ffffffULL,
+	0xffe1e1c1e7ffffffULL, 0x8f81818187ffffffULL, 0x0f01010107ffffffULL, 0x0701010107ffffffULL,
+	0xf8f0f0f0ffffffffULL, 0xfff1f0f1ffffffffULL, 0xfff1f1f1ffffffffULL, 0xfff1e1f1ffffffffULL,
+	0xffe1c1e1ffffffffULL, 0x8f818181ffffffffULL, 0x0f010101ffffffffULL, 0x0f010101ffffffffULL,
+	0xfcf0f0f1ffffffffULL, 0xfaf0f1f1ffffffffULL, 0x0000000000000000ULL, 0xfbe1f1f1ffffffffULL,
+	0xefc1e1f1ffffffffULL, 0x8f8181f1ffffffffULL, 0x0f0101f1ffffffffULL, 0x1f1111f1ffffffffULL,
+	0xfcf0f1f1ffffffffULL, 0xf8f1f1f1ffffffffULL, 0xf5f1f1f1ffffffffULL, 0xe3f1f1f1ffffffffULL,
+	0xd7e1f1f1ffffffffULL, 0x8f81f1f1ffffffffULL, 0x1f11f1f1ffffffffULL, 0x3f31f1f1ffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0e0e0e0f0fcfeffULL, 0xffe3e1e1f0f8fdffULL, 0xffe3e3e3f1f1fbffULL, 0xffe3e3e3e3e3f7ffULL,
+	0xffe3e3e3c7c7efffULL, 0xffe3c3c3878fdfffULL, 0xffe30303071fbfffULL, 0x07030303071f7fffULL,
+	0xf0e0e0e0f0f8ffffULL, 0xffe3e1e1f0f8ffffULL, 0xffe3e3e3f1f1ffffULL, 0xffe3e3e3e3e3ffffULL,
+	0xffe3e3e3c7c7ffffULL, 0xffe3c3c3878fffffULL, 0xff030303070fffffULL, 0x07030303070fffffULL,
+	0xf0e0e0e0f8ffffffULL, 0xffe1e1e0f9ffffffULL, 0xffe3e3e1fbffffffULL, 0xffe3e3e3f7ffffffULL,
+	0xffe3e3c3efffffffULL, 0xffc3c383cfffffffULL, 0x1f0303030fffffffULL, 0x070303030fffffffULL,
+	0xf0e0e0e0ffffffffULL, 0xffe1e0e1ffffffffULL, 0xffe3e1e3ffffffffULL, 0xffe3e3e3ffffffffULL,
+	0xffe3c3e3ffffffffULL, 0xffc383c3ffffffffULL, 0x1f030303ffffffffULL, 0x0f030303ffffffffULL,
+	0xf8e0e0e3ffffffffULL, 0xfde0e1e3ffffffffULL, 0xf7e1e3e3ffffffffULL, 0x0000000000000000ULL,
+	0xf7c3e3e3ffffffffULL, 0xdf83c3e3ffffffffULL, 0x1f0303e3ffffffffULL, 0x1f0303e3ffffffffULL,
+	0xfce0e3e3ffffffffULL, 0xfae1e3e3ffffffffULL, 0xf1e3e3e3ffffffffULL, 0xebe3e3e3ffffffffULL,
+	0xc7e3e3e3ffffffffULL, 0xafc3e3e3ffffffffULL, 0x1f03e3e3ffffffffULL, 0x3f23e3e3ffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf8f8f8f8f8f8feffULL, 0xfcfcfcf0f0f0fdffULL, 0xfcf8f8e0e0e0fbffULL, 0xfce0e0c0c0c0f7ffULL,
+	0xfc8080808080efffULL, 0x000000000000dfffULL, 0x000000010101bfffULL, 0x0000000303037fffULL,
+	0xf8f8f8f8f8f8ffffULL, 0xfcfcfcf8f0f0ffffULL, 0xfcf8f8f0e0e0ffffULL, 0xfce0e0e0c0c0ffffULL,
+	0x808080808080ffffULL, 0x000000000000ffffULL, 0x000000010101ffffULL, 0x000000030303ffffULL,
+	0xf8f8f8f8fcffffffULL, 0xfcfcfcf8f8ffffffULL, 0xfcf8f8f0f1ffffffULL, 0xe0e0e0e0e1ffffffULL,
+	0x8080808081ffffffULL, 0x0000000101ffffffULL, 0x0000000303ffffffULL, 0x0404040707ffffffULL,
+	0xf8f8f8feffffffffULL, 0xfcfcf8fdffffffffULL, 0xfcf8f0f9ffffffffULL, 0xe0e0e0e1ffffffffULL,
+	0x80808081ffffffffULL, 0x00000003ffffffffULL, 0x04040407ffffffffULL, 0x0c0c0c0fffffffffULL,
+	0xf8f8fcffffffffffULL, 0xfcf8fcffffffffffULL, 0xf8f0f8ffffffffffULL, 0xe0e0e0ffffffffffULL,
+	0x808080ffffffffffULL, 0x040404ffffffffffULL, 0x0c0c0cffffffffffULL, 0x1c1c1cffffffffffULL,
+	0x0000000000000000ULL, 0xf8fcfcffffffffffULL, 0xf4f8fcffffffffffULL, 0xe0e0fcffffffffffULL,
+	0xc4c4fcffffffffffULL, 0x8c8cfcffffffffffULL, 0x1c1cfcffffffffffULL, 0x3c3cfcffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf8f8f8f8f8f8feffULL, 0xf8f8f8f0f0f0fdffULL, 0xf8f8f8e0e0e0fbffULL, 0xf8f0f0c1c1c1f7ffULL,
+	0xf8c0c0818181efffULL, 0xf80000010101dfffULL, 0x000000010101bfffULL, 0x0000000303037fffULL,
+	0xf8f8f8f8f8f8ffffULL, 0xf8f8f8f8f0f0ffffULL, 0xf8f8f8f1e0e0ffffULL, 0xf8f0f0e1c1c1ffffULL,
+	0xf8c0c0c18181ffffULL, 0x000000010101ffffULL, 0x000000010101ffffULL, 0x000000030303ffffULL,
+	0xf8f8f8fcfcffffffULL, 0xf8f8f8f8f8ffffffULL, 0xf8f8f8f1f1ffffffULL, 0xf8f0f0e1e3ffffffULL,
+	0xc0c0c0c1c3ffffffULL, 0x0000000103ffffffULL, 0x0000000303ffffffULL, 0x0000000707ffffffULL,
+	0xf8f8f8feffffffffULL, 0xf8f8f8fdffffffffULL, 0xf8f8f0fbffffffffULL, 0xf8f0e0f3ffffffffULL,
+	0xc0c0c0c3ffffffffULL, 0x00000003ffffffffULL, 0x00000007ffffffffULL, 0x0808080fffffffffULL,
+	0xf8f8f8ffffffffffULL, 0xf8f8f8ffffffffffULL, 0xf8f0f8ffffffffffULL, 0xf0e0f0ffffffffffULL,
+	0xc0c0c0ffffffffffULL, 0x000000ffffffffffULL, 0x080808ffffffffffULL, 0x181818ffffffffffULL,
+	0xf8f8f8ffffffffffULL, 0x0000000000000000ULL, 0xf0f8f8ffffffffffULL, 0xe8f0f8ffffffffffULL,
+	0xc0c0f8ffffffffffULL, 0x8888f8ffffffffffULL, 0x1818f8ffffffffffULL, 0x3838f8ffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0f0f0f8f8f8feffULL, 0xf1f1f1f0f0f0fdffULL, 0xf1f1f1e0e0e0fbffULL, 0xf1f1f1c1c1c1f7ffULL,
+	0xf1e1e1838383efffULL, 0xf18181030303dfffULL, 0xf10101030303bfffULL, 0x0101010303037fffULL,
+	0xf0f0f0f8f8f8ffffULL, 0xf1f1f1f8f0f0ffffULL, 0xf1f1f1f1e0e0ffffULL, 0xf1f1f1e3c1c1ffffULL,
+	0xf1e1e1c38383ffffULL, 0xf18181830303ffffULL, 0x010101030303ffffULL, 0x010101030303ffffULL,
+	0xf0f0f0f8fcffffffULL, 0xf1f1f1f8f8ffffffULL, 0xf1f1f1f1f1ffffffULL, 0xf1f1f1e3e3ffffffULL,
+	0xf1e1e1c3c7ffffffULL, 0x8181818387ffffffULL, 0x0101010307ffffffULL, 0x0101010707ffffffULL,
+	0xf0f0f0fcffffffffULL, 0xf1f1f0fdffffffffULL, 0xf1f1f1fbffffffffULL, 0xf1f1e1f7ffffffffULL,
+	0xf1e1c1e7ffffffffULL, 0x81818187ffffffffULL, 0x01010107ffffffffULL, 0x0101010fffffffffULL,
+	0xf0f0f0ffffffffffULL, 0xf1f0f1ffffffffffULL, 0xf1f1f1ffffffffffULL, 0xf1e1f1ffffffffffULL,
+	0xe1c1e1ffffffffffULL, 0x818181ffffffffffULL, 0x010101ffffffffffULL, 0x111111ffffffffffULL,
+	0xf0f0f1ffffffffffULL, 0xf0f1f1ffffffffffULL, 0x0000000000000000ULL, 0xe1f1f1ffffffffffULL,
+	0xd1e1f1ffffffffffULL, 0x8181f1ffffffffffULL, 0x1111f1ffffffffffULL, 0x3131f1ffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xe0e0e0f0f0f0feffULL, 0xe3e1e1f0f0f0fdffULL, 0xe3e3e3e0e0e0fbffULL, 0xe3e3e3c1c1c1f7ffULL,
+	0xe3e3e3838383efffULL, 0xe3c3c3070707dfffULL, 0xe30303070707bfffULL, 0x0303030707077fffULL,
+	0xe0e0e0f0f0f0ffffULL, 0xe3e1e1f0f0f0ffffULL, 0xe3e3e3f1e0e0ffffULL, 0xe3e3e3e3c1c1ffffULL,
+	0xe3e3e3c78383ffffULL, 0xe3c3c3870707ffffULL, 0xe30303070707ffffULL, 0x030303070707ffffULL,
+	0xe0e0e0f0f8ffffffULL, 0xe3e1e1f0f8ffffffULL, 0xe3e3e3f1f1ffffffULL, 0xe3e3e3e3e3ffffffULL,
+	0xe3e3e3c7c7ffffffULL, 0xe3c3c3878fffffffULL, 0x030303070fffffffULL, 0x030303070fffffffULL,
+	0xe0e0e0f8ffffffffULL, 0xe3e1e0f9ffffffffULL, 0xe3e3e1fbffffffffULL, 0xe3e3e3f7ffffffffULL,
+	0xe3e3c3efffffffffULL, 0xe3c383cfffffffffULL, 0x0303030fffffffffULL, 0x0303030fffffffffULL,
+	0xe0e0e0ffffffffffULL, 0xe1e0e1ffffffffffULL, 0xe3e1e3ffffffffffULL, 0xe3e3e3ffffffffffULL,
+	0xe3c3e3ffffffffffULL, 0xc383c3ffffffffffULL, 0x030303ffffffffffULL, 0x030303ffffffffffULL,
+	0xe0e0e3ffffffffffULL, 0xe2e1e3ffffffffffULL, 0xe1e3e3ffffffffffULL, 0x0000000000000000ULL,
+	0xc3e3e3ffffffffffULL, 0xa3c3e3ffffffffffULL, 0x0303e3ffffffffffULL, 0x2323e3ffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf8f8f0f0f0f0feffULL, 0xfcfce0e0e0e0fdffULL, 0xf8f8c0c0c0c0fbffULL, 0xe0e080808080f7ffULL,
+	0x808000000000efffULL, 0x000000000000dfffULL, 0x000001010101bfffULL, 0x0000030303037fffULL,
+	0xf8f8f0f0f0f0ffffULL, 0xfcfcf0e0e0e0ffffULL, 0xf8f8e0c0c0c0ffffULL, 0xe0e0c0808080ffffULL,
+	0x808080000000ffffULL, 0x000000000000ffffULL, 0x000001010101ffffULL, 0x000003030303ffffULL,
+	0xf8f8f8f8f8ffffffULL, 0xfcfcf8f0f0ffffffULL, 0xf8f8f0e0e0ffffffULL, 0xe0e0e0c0c0ffffffULL,
+	0x8080808080ffffffULL, 0x0000010101ffffffULL, 0x0000030303ffffffULL, 0x0404070707ffffffULL,
+	0xf8f8f8fcffffffffULL, 0xfcfcf8f8ffffffffULL, 0xf8f8f0f1ffffffffULL, 0xe0e0e0e1ffffffffULL,
+	0x80808181ffffffffULL, 0x00000303ffffffffULL, 0x04040707ffffffffULL, 0x0c0c0f0fffffffffULL,
+	0xf8f8fcffffffffffULL, 0xfcf8fdffffffffffULL, 0xf8f0f9ffffffffffULL, 0xe0e0e1ffffffffffULL,
+	0x808083ffffffffffULL, 0x040407ffffffffffULL, 0x0c0c0fffffffffffULL, 0x1c1c1fffffffffffULL,
+	0xf8f8ffffffffffffULL, 0xf8fcffffffffffffULL, 0xf0f8ffffffffffffULL, 0xe0e0ffffffffffffULL,
+	0xc4c4ffffffffffffULL, 0x8c8cffffffffffffULL, 0x1c1cffffffffffffULL, 0x3c3cffffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf8f8f0f0f0f0feffULL, 0xf8f8e0e0e0e0fdffULL, 0xf8f8c0c0c0c0fbffULL, 0xf0f080808080f7ffULL,
+	0xc0c001010101efffULL, 0x000001010101dfffULL, 0x000001010101bfffULL, 0x0000030303037fffULL,
+	0xf8f8f0f0f0f0ffffULL, 0xf8f8f0e0e0e0ffffULL, 0xf8f8e0c0c0c0ffffULL, 0xf0f0c1808080ffffULL,
+	0xc0c081010101ffffULL, 0x000001010101ffffULL, 0x000001010101ffffULL, 0x000003030303ffffULL,
+	0xf8f8f8f8f8ffffffULL, 0xf8f8f8f0f0ffffffULL, 0xf8f8f1e0e0ffffffULL, 0xf0f0e1c1c1ffffffULL,
+	0xc0c0c18181ffffffULL, 0x0000010101ffffffULL, 0x0000030303ffffffULL, 0x0000070707ffffffULL,
+	0xf8f8fcfcffffffffULL, 0xf8f8f8f8ffffffffULL, 0xf8f8f1f1ffffffffULL, 0xf0f0e1e3ffffffffULL,
+	0xc0c0c1c3ffffffffULL, 0x00000303ffffffffULL, 0x00000707ffffffffULL, 0x08080f0fffffffffULL,
+	0xf8f8feffffffffffULL, 0xf8f8fdffffffffffULL, 0xf8f0fbffffffffffULL, 0xf0e0f3ffffffffffULL,
+	0xc0c0c3ffffffffffULL, 0x000007ffffffffffULL, 0x08080fffffffffffULL, 0x18181fffffffffffULL,
+	0xf8f8ffffffffffffULL, 0xf8f8ffffffffffffULL, 0xf0f8ffffffffffffULL, 0xe0f0ffffffffffffULL,
+	0xc0c0ffffffffffffULL, 0x8888ffffffffffffULL, 0x1818ffffffffffffULL, 0x3838ffffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0f0f0f0f0f0feffULL, 0xf1f1e0e0e0e0fdffULL, 0xf1f1c0c0c0c0fbffULL, 0xf1f180808080f7ffULL,
+	0xe1e101010101efffULL, 0x818103030303dfffULL, 0x010103030303bfffULL, 0x0101030303037fffULL,
+	0xf0f0f0f0f0f0ffffULL, 0xf1f1f0e0e0e0ffffULL, 0xf1f1e0c0c0c0ffffULL, 0xf1f1c1808080ffffULL,
+	0xe1e183010101ffffULL, 0x818103030303ffffULL, 0x010103030303ffffULL, 0x010103030303ffffULL,
+	0xf0f0f8f8f8ffffffULL, 0xf1f1f8f0f0ffffffULL, 0xf1f1f1e0e0ffffffULL, 0xf1f1e3c1c1ffffffULL,
+	0xe1e1c38383ffffffULL, 0x8181830303ffffffULL, 0x0101030303ffffffULL, 0x0101070707ffffffULL,
+	0xf0f0f8fcffffffffULL, 0xf1f1f8f8ffffffffULL, 0xf1f1f1f1ffffffffULL, 0xf1f1e3e3ffffffffULL,
+	0xe1e1c3c7ffffffffULL, 0x81818387ffffffffULL, 0x01010707ffffffffULL, 0x01010f0fffffffffULL,
+	0xf0f0fcffffffffffULL, 0xf1f0fdffffffffffULL, 0xf1f1fbffffffffffULL, 0xf1e1f7ffffffffffULL,
+	0xe1c1e7ffffffffffULL, 0x818187ffffffffffULL, 0x01010fffffffffffULL, 0x11111fffffffffffULL,
+	0xf0f0ffffffffffffULL, 0xf0f1ffffffffffffULL, 0xf1f1ffffffffffffULL, 0xe1f1ffffffffffffULL,
+	0xc1e1ffffffffffffULL, 0x8181ffffffffffffULL, 0x1111ffffffffffffULL, 0x3131ffffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xe0e0f0f0f0f0feffULL, 0xe1e1e0e0e0e0fdffULL, 0xe3e3c0c0c0c0fbffULL, 0xe3e380808080f7ffULL,
+	0xe3e301010101efffULL, 0xc3c303030303dfffULL, 0x030307070707bfffULL, 0x0303070707077fffULL,
+	0xe0e0f0f0f0f0ffffULL, 0xe1e1f0e0e0e0ffffULL, 0xe3e3e0c0c0c0ffffULL, 0xe3e3c1808080ffffULL,
+	0xe3e383010101ffffULL, 0xc3c307030303ffffULL, 0x030307070707ffffULL, 0x030307070707ffffULL,
+	0xe0e0f0f0f0ffffffULL, 0xe1e1f0f0f0ffffffULL, 0xe3e3f1e0e0ffffffULL, 0xe3e3e3c1c1ffffffULL,
+	0xe3e3c78383ffffffULL, 0xc3c3870707ffffffULL, 0x0303070707ffffffULL, 0x0303070707ffffffULL,
+	0xe0e0f0f8ffffffffULL, 0xe1e1f0f8ffffffffULL, 0xe3e3f1f1ffffffffULL, 0xe3e3e3e3ffffffffULL,
+	0xe3e3c7c7ffffffffULL, 0xc3c3878fffffffffULL, 0x0303070fffffffffULL, 0x03030f0fffffffffULL,
+	0xe0e0f8ffffffffffULL, 0xe0e0f9ffffffffffULL, 0xe3e1fbffffffffffULL, 0xe3e3f7ffffffffffULL,
+	0xe3c3efffffffffffULL, 0xc383cfffffffffffULL, 0x03030fffffffffffULL, 0x03031fffffffffffULL,
+	0xe0e0ffffffffffffULL, 0xe0e1ffffffffffffULL, 0xe1e3ffffffffffffULL, 0xe3e3ffffffffffffULL,
+	0xc3e3ffffffffffffULL, 0x83c3ffffffffffffULL, 0x0303ffffffffffffULL, 0x2323ffffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x80808080808080fcULL, 0xf0f0f0f0f0f0f8fcULL, 0xe0e0e0e0e0e0f0f0ULL, 0xc0c0c0c0c0c0e0e0ULL,
+	0x00000000000000c4ULL, 0x000000000000008cULL, 0x000000000000001cULL, 0x010101010101003cULL,
+	0x80808080808080fcULL, 0xe0e0e0e0e0e0f0fcULL, 0xc0c0c0c0c0c0e0fcULL, 0x808080808080c0fcULL,
+	0x00000000000000fcULL, 0x00000000000000fcULL, 0x00000000000000fcULL, 0x01010101010100fcULL,
+	0xc0c0c0c0c0c0fcfcULL, 0xc0c0c0c0c0c0fcfcULL, 0x808080808080fcfcULL, 0x000000000000fcfcULL,
+	0x000000000000fcfcULL, 0x000000000000fcfcULL, 0x010101010101fcfcULL, 0x030303030303fcfcULL,
+	0xe0e0e0e0e0fffcfcULL, 0xc0c0c0c0c0fffcfcULL, 0x8080808080fffcfcULL, 0x0000000000fffcfcULL,
+	0x0000000000fffcfcULL, 0x0101010101fffcfcULL, 0x0303030303fffcfcULL, 0x0707070707fffcfcULL,
+	0xf0f0f0f0fffffcfcULL, 0xe0e0e0e0fffffcfcULL, 0xc0c0c0c0fffffcfcULL, 0x80808080fffffcfcULL,
+	0x01010101fffffcfcULL, 0x03030303fffffcfcULL, 0x07070707fffffcfcULL, 0x0f0f0f0ffffffcfcULL,
+	0xf8f8f8fffffffcfcULL, 0xf0f0f0fffffffcfcULL, 0xe0e0e0fffffffcfcULL, 0xc1c1c1fffffffcfcULL,
+	0x838383fffffffcfcULL, 0x070707fffffffcfcULL, 0x0f0f0ffffffffcfcULL, 0x1f1f1ffffffffcfcULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x80808080808080f8ULL, 0xf0f0f0f0f0f0f8f8ULL, 0xe0e0e0e0e0e0f0f8ULL, 0xc0c0c0c0c0c0e0e0ULL,
+	0x808080808080c0c0ULL, 0x0000000000000088ULL, 0x0000000000000018ULL, 0x0101010101010038ULL,
+	0x80808080808080f8ULL, 0xe0e0e0e0e0e0f0f8ULL, 0xc0c0c0c0c0c0e0f8ULL, 0x808080808080c0f8ULL,
+	0x00000000000080f8ULL, 0x00000000000000f8ULL, 0x00000000000000f8ULL, 0x01010101010100f8ULL,
+	0xc0c0c0c0c0c0f8f8ULL, 0xc0c0c0c0c0c0f8f8ULL, 0x808080808080f8f8ULL, 0x000000000000f8f8ULL,
+	0x000000000000f8f8ULL, 0x000000000000f8f8ULL, 0x010101010101f8f8ULL, 0x030303030303f8f8ULL,
+	0xe0e0e0e0e0fff8f8ULL, 0xc0c0c0c0c0fff8f8ULL, 0x8080808080fff8f8ULL, 0x0000000000fff8f8ULL,
+	0x0000000000fff8f8ULL, 0x0101010101fff8f8ULL, 0x0303030303fff8f8ULL, 0x0707070707fff8f8ULL,
+	0xf0f0f0f0fffff8f8ULL, 0xe0e0e0e0fffff8f8ULL, 0xc0c0c0c0fffff8f8ULL, 0x80808080fffff8f8ULL,
+	0x01010101fffff8f8ULL, 0x03030303fffff8f8ULL, 0x07070707fffff8f8ULL, 0x0f0f0f0ffffff8f8ULL,
+	0xf8f8f8fffffff8f8ULL, 0xf0f0f0fffffff8f8ULL, 0xe0e0e0fffffff8f8ULL, 0xc1c1c1fffffff8f8ULL,
+	0x838383fffffff8f8ULL, 0x070707fffffff8f8ULL, 0x0f0f0ffffffff8f8ULL, 0x1f1f1ffffffff8f8ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x80808080808080f0ULL, 0xe0e0e0e0e0e0e0f1ULL, 0xe0e0e0e0e0e0f1f1ULL, 0xc0c0c0c0c0c0e0f1ULL,
+	0x818181818181c1c1ULL, 0x0101010101018181ULL, 0x0101010101010111ULL, 0x0101010101010131ULL,
+	0x80808080808080f1ULL, 0xe0e0e0e0e0e0f0f1ULL, 0xc0c0c0c0c0c0e0f1ULL, 0x808080808080c1f1ULL,
+	0x00000000000080f1ULL, 0x01010101010101f1ULL, 0x01010101010101f1ULL, 0x01010101010101f1ULL,
+	0xc0c0c0c0c0c0f1f1ULL, 0xc0c0c0c0c0c0f1f1ULL, 0x808080808080f1f1ULL, 0x000000000000f1f1ULL,
+	0x000000000000f1f1ULL, 0x000000000000f1f1ULL, 0x010101010101f1f1ULL, 0x030303030303f1f1ULL,
+	0xe0e0e0e0e0fff1f1ULL, 0xc0c0c0c0c0fff1f1ULL, 0x8080808080fff1f1ULL, 0x0000000000fff1f1ULL,
+	0x0000000000fff1f1ULL, 0x0101010101fff1f1ULL, 0x0303030303fff1f1ULL, 0x0707070707fff1f1ULL,
+	0xf0f0f0f0fffff1f1ULL, 0xe0e0e0e0fffff1f1ULL, 0xc0c0c0c0fffff1f1ULL, 0x80808080fffff1f1ULL,
+	0x01010101fffff1f1ULL, 0x03030303fffff1f1ULL, 0x07070707fffff1f1ULL, 0x0f0f0f0ffffff1f1ULL,
+	0xf8f8f8fffffff1f1ULL, 0xf0f0f0fffffff1f1ULL, 0xe0e0e0fffffff1f1ULL, 0xc1c1c1fffffff1f1ULL,
+	0x838383fffffff1f1ULL, 0x070707fffffff1f1ULL, 0x0f0f0ffffffff1f1ULL, 0x1f1f1ffffffff1f1ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x80808080808080e0ULL, 0xe0e0e0e0e0e0e0e0ULL, 0xc0c0c0c0c0c0c1e3ULL, 0xc1c1c1c1c1c1e3e3ULL,
+	0x818181818181c1e3ULL, 0x0303030303038383ULL, 0x0303030303030303ULL, 0x0101010101010123ULL,
+	0x80808080808080e3ULL, 0xc0c0c0c0c0c0c0e3ULL, 0xc0c0c0c0c0c0e0e3ULL, 0x808080808080c1e3ULL,
+	0x01010101010183e3ULL, 0x01010101010101e3ULL, 0x03030303030303e3ULL, 0x01010101010101e3ULL,
+	0xc0c0c0c0c0c0e3e3ULL, 0xc0c0c0c0c0c0e3e3ULL, 0x808080808080e3e3ULL, 0x000000000000e3e3ULL,
+	0x000000000000e3e3ULL, 0x010101010101e3e3ULL, 0x010101010101e3e3ULL, 0x030303030303e3e3ULL,
+	0xe0e0e0e0e0ffe3e3ULL, 0xc0c0c0c0c0ffe3e3ULL, 0x8080808080ffe3e3ULL, 0x0000000000ffe3e3ULL,
+	0x0000000000ffe3e3ULL, 0x0101010101ffe3e3ULL, 0x0303030303ffe3e3ULL, 0x0707070707ffe3e3ULL,
+	0xf0f0f0f0ffffe3e3ULL, 0xe0e0e0e0ffffe3e3ULL, 0xc0c0c0c0ffffe3e3ULL, 0x80808080ffffe3e3ULL,
+	0x01010101ffffe3e3ULL, 0x03030303ffffe3e3ULL, 0x07070707ffffe3e3ULL, 0x0f0f0f0fffffe3e3ULL,
+	0xf8f8f8ffffffe3e3ULL, 0xf0f0f0ffffffe3e3ULL, 0xe0e0e0ffffffe3e3ULL, 0xc1c1c1ffffffe3e3ULL,
+	0x838383ffffffe3e3ULL, 0x070707ffffffe3e3ULL, 0x0f0f0fffffffe3e3ULL, 0x1f1f1fffffffe3e3ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0xfff8f8f8f8f8fcfcULL, 0xfff0f0f0f0f0f0f0ULL, 0xffc0c0c0c0c0e0e0ULL,
+	0x01000000000000c4ULL, 0x010000000000008cULL, 0x010000000000001cULL, 0x010101010100003cULL,
+	0x808080808080f0fcULL, 0xf0f0f0f0f0f8fcfcULL, 0xe0e0e0e0e0f0f0fcULL, 0xc0c0c0c0c0c0c0fcULL,
+	0x00000000000000fcULL, 0x00000000000000fcULL, 0x00000000000000fcULL, 0x01010101010000fcULL,
+	0xc0c0c0c0c0c0fcfcULL, 0xe0e0e0e0e0f0fcfcULL, 0xc0c0c0c0c0e0fcfcULL, 0x8080808080c0fcfcULL,
+	0x000000000000fcfcULL, 0x000000000000fcfcULL, 0x010101010100fcfcULL, 0x030303030300fcfcULL,
+	0xe0e0e0e0e0fcfcfcULL, 0xc0c0c0c0c0fcfcfcULL, 0x8080808080fcfcfcULL, 0x0000000000fcfcfcULL,
+	0x0000000000fcfcfcULL, 0x0101010101fcfcfcULL, 0x0303030303fcfcfcULL, 0x0707070707fcfcfcULL,
+	0xf0f0f0f0fffcfcfcULL, 0xe0e0e0e0fffcfcfcULL, 0xc0c0c0c0fffcfcfcULL, 0x80808080fffcfcfcULL,
+	0x01010101fffcfcfcULL, 0x03030303fffcfcfcULL, 0x07070707fffcfcfcULL, 0x0f0f0f0ffffcfcfcULL,
+	0xf8f8f8fffffcfcfcULL, 0xf0f0f0fffffcfcfcULL, 0xe0e0e0fffffcfcfcULL, 0xc1c1c1fffffcfcfcULL,
+	0x838383fffffcfcfcULL, 0x070707fffffcfcfcULL, 0x0f0f0ffffffcfcfcULL, 0x1f1f1ffffffcfcfcULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x808080808080f8f8ULL, 0x0000000000000000ULL, 0xfff0f0f0f0f0f8f8ULL, 0xffe0e0e0e0e0e0e0ULL,
+	0xff8080808080c0c0ULL, 0x0300000000000088ULL, 0x0300000000000018ULL, 0x0101010101000038ULL,
+	0x808080808080f8f8ULL, 0xf0f0f0f0f0f8f8f8ULL, 0xe0e0e0e0e0f0f8f8ULL, 0xc0c0c0c0c0e0e0f8ULL,
+	0x80808080808080f8ULL, 0x00000000000000f8ULL, 0x00000000000000f8ULL, 0x01010101010000f8ULL,
+	0xc0c0c0c0c0c0f8f8ULL, 0xe0e0e0e0e0f0f8f8ULL, 0xc0c0c0c0c0e0f8f8ULL, 0x8080808080c0f8f8ULL,
+	0x000000000080f8f8ULL, 0x000000000000f8f8ULL, 0x010101010100f8f8ULL, 0x030303030300f8f8ULL,
+	0xe0e0e0e0e0f8f8f8ULL, 0xc0c0c0c0c0f8f8f8ULL, 0x8080808080f8f8f8ULL, 0x0000000000f8f8f8ULL,
+	0x0000000000f8f8f8ULL, 0x0101010101f8f8f8ULL, 0x0303030303f8f8f8ULL, 0x0707070707f8f8f8ULL,
+	0xf0f0f0f0fff8f8f8ULL, 0xe0e0e0e0fff8f8f8ULL, 0xc0c0c0c0fff8f8f8ULL, 0x80808080fff8f8f8ULL,
+	0x01010101fff8f8f8ULL, 0x03030303fff8f8f8ULL, 0x07070707fff8f8f8ULL, 0x0f0f0f0ffff8f8f8ULL,
+	0xf8f8f8fffff8f8f8ULL, 0xf0f0f0fffff8f8f8ULL, 0xe0e0e0fffff8f8f8ULL, 0xc1c1c1fffff8f8f8ULL,
+	0x838383fffff8f8f8ULL, 0x070707fffff8f8f8ULL, 0x0f0f0ffffff8f8f8ULL, 0x1f1f1ffffff8f8f8ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x808080808080f0f0ULL, 0xfff0f0f0f0f0f1f1ULL, 0x0000000000000000ULL, 0xffe1e1e1e1e1f1f1ULL,
+	0xffc1c1c1c1c1c1c1ULL, 0xff01010101018181ULL, 0x0701010101010111ULL, 0x0101010101010131ULL,
+	0x808080808080f0f1ULL, 0xe0e0e0e0e0e0f1f1ULL, 0xe0e0e0e0e0f1f1f1ULL, 0xc0c0c0c0c0e0f1f1ULL,
+	0x8181818181c1c1f1ULL, 0x01010101010101f1ULL, 0x01010101010101f1ULL, 0x01010101010101f1ULL,
+	0xc0c0c0c0c0c0f1f1ULL, 0xe0e0e0e0e0f0f1f1ULL, 0xc0c0c0c0c0e0f1f1ULL, 0x8080808080c1f1f1ULL,
+	0x000000000080f1f1ULL, 0x010101010101f1f1ULL, 0x010101010101f1f1ULL, 0x030303030301f1f1ULL,
+	0xe0e0e0e0e0f1f1f1ULL, 0xc0c0c0c0c0f1f1f1ULL, 0x8080808080f1f1f1ULL, 0x0000000000f1f1f1ULL,
+	0x0000000000f1f1f1ULL, 0x0101010101f1f1f1ULL, 0x0303030303f1f1f1ULL, 0x0707070707f1f1f1ULL,
+	0xf0f0f0f0fff1f1f1ULL, 0xe0e0e0e0fff1f1f1ULL, 0xc0c0c0c0fff1f1f1ULL, 0x80808080fff1f1f1ULL,
+	0x01010101fff1f1f1ULL, 0x03030303fff1f1f1ULL, 0x07070707fff1f1f1ULL, 0x0f0f0f0ffff1f1f1ULL,
+	0xf8f8f8fffff1f1f1ULL, 0xf0f0f0fffff1f1f1ULL, 0xe0e0e0fffff1f1f1ULL, 0xc1c1c1fffff1f1f1ULL,
+	0x838383fffff1f1f1ULL, 0x070707fffff1f1f1ULL, 0x0f0f0ffffff1f1f1ULL, 0x1f1f1ffffff1f1f1ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x808080808080e0e0ULL, 0xffe0e0e0e0e0e0e0ULL, 0xffe1e1e1e1e1e3e3ULL, 0x0000000000000000ULL,
+	0xffc3c3c3c3c3e3e3ULL, 0xff83838383838383ULL, 0xff03030303030303ULL, 0x0101010101010323ULL,
+	0x808080808080e0e3ULL, 0xe0e0e0e0e0e0e0e3ULL, 0xc0c0c0c0c0c1e3e3ULL, 0xc1c1c1c1c1e3e3e3ULL,
+	0x8181818181c1e3e3ULL, 0x03030303038383e3ULL, 0x03030303030303e3ULL, 0x01010101010103e3ULL,
+	0xc0c0c0c0c0c0e3e3ULL, 0xc0c0c0c0c0c0e3e3ULL, 0xc0c0c0c0c0e0e3e3ULL, 0x8080808080c1e3e3ULL,
+	0x010101010183e3e3ULL, 0x010101010101e3e3ULL, 0x030303030303e3e3ULL, 0x030303030303e3e3ULL,
+	0xe0e0e0e0e0e3e3e3ULL, 0xc0c0c0c0c0e3e3e3ULL, 0x8080808080e3e3e3ULL, 0x0000000000e3e3e3ULL,
+	0x0000000000e3e3e3ULL, 0x0101010101e3e3e3ULL, 0x0303030303e3e3e3ULL, 0x0707070707e3e3e3ULL,
+	0xf0f0f0f0ffe3e3e3ULL, 0xe0e0e0e0ffe3e3e3ULL, 0xc0c0c0c0ffe3e3e3ULL, 0x80808080ffe3e3e3ULL,
+	0x01010101ffe3e3e3ULL, 0x03030303ffe3e3e3ULL, 0x07070707ffe3e3e3ULL, 0x0f0f0f0fffe3e3e3ULL,
+	0xf8f8f8ffffe3e3e3ULL, 0xf0f0f0ffffe3e3e3ULL, 0xe0e0e0ffffe3e3e3ULL, 0xc1c1c1ffffe3e3e3ULL,
+	0x838383ffffe3e3e3ULL, 0x070707ffffe3e3e3ULL, 0x0f0f0fffffe3e3e3ULL, 0x1f1f1fffffe3e3e3ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x8080808080f0f0ffULL, 0xfffffcfdfcfcfcffULL, 0xfffff0f1f0f0f0f1ULL, 0xffc1c0c1c0c0e0e3ULL,
+	0x01010001000000c7ULL, 0x010100010000008fULL, 0x010101010000001fULL, 0x010101010000003fULL,
+	0x0000000000000000ULL, 0xf8f8f8f8f8fcfcffULL, 0xf0f0f0f0f0f0f0ffULL, 0xc0c0c0c0c0c0c0ffULL,
+	0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x01010101000000ffULL,
+	0xc0c0c0c0c0f0fcffULL, 0xf0f0f0f0f8fcfcffULL, 0xe0e0e0e0f0f0fcffULL, 0xc0c0c0c0c0c0fcffULL,
+	0x000000000000fcffULL, 0x000000000000fcffULL, 0x010101010000fcffULL, 0x030303030000fcffULL,
+	0xe0e0e0e0e0fcfcffULL, 0xe0e0e0e0f0fcfcffULL, 0xc0c0c0c0e0fcfcffULL, 0x80808080c0fcfcffULL,
+	0x0000000000fcfcffULL, 0x0101010100fcfcffULL, 0x0303030300fcfcffULL, 0x0707070704fcfcffULL,
+	0xf0f0f0f0fcfcfcffULL, 0xe0e0e0e0fcfcfcffULL, 0xc0c0c0c0fcfcfcffULL, 0x80808080fcfcfcffULL,
+	0x01010101fcfcfcffULL, 0x03030303fcfcfcffULL, 0x07070707fcfcfcffULL, 0x0f0f0f0ffcfcfcffULL,
+	0xf8f8f8fffcfcfcffULL, 0xf0f0f0fffcfcfcffULL, 0xe0e0e0fffcfcfcffULL, 0xc1c1c1fffcfcfcffULL,
+	0x838383fffcfcfcffULL, 0x070707fffcfcfcffULL, 0x0f0f0ffffcfcfcffULL, 0x1f1f1ffffcfcfcffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x8080808080f8f8ffULL, 0xfffff8faf8f8f8ffULL, 0xfffff8faf8f8f8ffULL, 0xffffe0e2e0e0e0e3ULL,
+	0xff8380828080c0c7ULL, 0x030300020000008fULL, 0x030300020000001fULL, 0x010101010000003fULL,
+	0x8080808080f8f8ffULL, 0x0000000000000000ULL, 0xf0f0f0f0f0f8f8ffULL, 0xe0e0e0e0e0e0e0ffULL,
+	0x80808080808080ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x01010101000000ffULL,
+	0xc0c0c0c0c0f8f8ffULL, 0xf0f0f0f0f8f8f8ffULL, 0xe0e0e0e0f0f8f8ffULL, 0xc0c0c0c0e0e0f8ffULL,
+	0x808080808080f8ffULL, 0x000000000000f8ffULL, 0x010101010000f8ffULL, 0x030303030000f8ffULL,
+	0xe0e0e0e0e0f8f8ffULL, 0xe0e0e0e0f0f8f8ffULL, 0xc0c0c0c0e0f8f8ffULL, 0x80808080c0f8f8ffULL,
+	0x0000000080f8f8ffULL, 0x0101010100f8f8ffULL, 0x0303030300f8f8ffULL, 0x0707070700f8f8ffULL,
+	0xf0f0f0f0f8f8f8ffULL, 0xe0e0e0e0f8f8f8ffULL, 0xc0c0c0c0f8f8f8ffULL, 0x80808080f8f8f8ffULL,
+	0x01010101f8f8f8ffULL, 0x03030303f8f8f8ffULL, 0x07070707f8f8f8ffULL, 0x0f0f0f0ff8f8f8ffULL,
+	0xf8f8f8fff8f8f8ffULL, 0xf0f0f0fff8f8f8ffULL, 0xe0e0e0fff8f8f8ffULL, 0xc1c1c1fff8f8f8ffULL,
+	0x838383fff8f8f8ffULL, 0x070707fff8f8f8ffULL, 0x0f0f0ffff8f8f8ffULL, 0x1f1f1ffff8f8f8ffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x8080808080f0f0fcULL, 0xfffff1f5f1f1f1ffULL, 0xfffff1f5f1f1f1ffULL, 0xfffff1f5f1f1f1ffULL,
+	0xffffc1c5c1c1c1c7ULL, 0xff0701050101818fULL, 0x070701050101011fULL, 0x010101010101013fULL,
+	0x8080808080f0f0ffULL, 0xf0f0f0f0f0f1f1ffULL, 0x0000000000000000ULL, 0xe1e1e1e1e1f1f1ffULL,
+	0xc1c1c1c1c1c1c1ffULL, 0x01010101010101ffULL, 0x01010101010101ffULL, 0x01010101010101ffULL,
+	0xc0c0c0c0c0f0f1ffULL, 0xe0e0e0e0e0f1f1ffULL, 0xe0e0e0e0f1f1f1ffULL, 0xc0c0c0c0e0f1f1ffULL,
+	0x81818181c1c1f1ffULL, 0x010101010101f1ffULL, 0x010101010101f1ffULL, 0x030303030101f1ffULL,
+	0xe0e0e0e0e0f1f1ffULL, 0xe0e0e0e0f0f1f1ffULL, 0xc0c0c0c0e0f1f1ffULL, 0x80808080c1f1f1ffULL,
+	0x0000000080f1f1ffULL, 0x0101010101f1f1ffULL, 0x0303030301f1f1ffULL, 0x0707070701f1f1ffULL,
+	0xf0f0f0f0f1f1f1ffULL, 0xe0e0e0e0f1f1f1ffULL, 0xc0c0c0c0f1f1f1ffULL, 0x80808080f1f1f1ffULL,
+	0x01010101f1f1f1ffULL, 0x03030303f1f1f1ffULL, 0x07070707f1f1f1ffULL, 0x0f0f0f0ff1f1f1ffULL,
+	0xf8f8f8fff1f1f1ffULL, 0xf0f0f0fff1f1f1ffULL, 0xe0e0e0fff1f1f1ffULL, 0xc1c1c1fff1f1f1ffULL,
+	0x838383fff1f1f1ffULL, 0x070707fff1f1f1ffULL, 0x0f0f0ffff1f1f1ffULL, 0x1f1f1ffff1f1f1ffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x8080808080e0e0fcULL, 0xffffe0e8e0e0e0f8ULL, 0xffffe3ebe3e3e3ffULL, 0xffffe3ebe3e3e3ffULL,
+	0xffffe3ebe3e3e3ffULL, 0xffff838b8383838fULL, 0xff0f030b0303031fULL, 0x010101010103033fULL,
+	0x8080808080e0e0ffULL, 0xe0e0e0e0e0e0e0ffULL, 0xe1e1e1e1e1e3e3ffULL, 0x0000000000000000ULL,
+	0xc3c3c3c3c3e3e3ffULL, 0x83838383838383ffULL, 0x03030303030303ffULL, 0x01010101010303ffULL,
+	0xc0c0c0c0c0e0e3ffULL, 0xe0e0e0e0e0e0e3ffULL, 0xc0c0c0c0c1e3e3ffULL, 0xc1c1c1c1e3e3e3ffULL,
+	0x81818181c1e3e3ffULL, 0x030303038383e3ffULL, 0x030303030303e3ffULL, 0x030303030303e3ffULL,
+	0xe0e0e0e0e0e3e3ffULL, 0xc0c0c0c0c0e3e3ffULL, 0xc0c0c0c0e0e3e3ffULL, 0x80808080c1e3e3ffULL,
+	0x0101010183e3e3ffULL, 0x0101010101e3e3ffULL, 0x0303030303e3e3ffULL, 0x0707070703e3e3ffULL,
+	0xf0f0f0f0e3e3e3ffULL, 0xe0e0e0e0e3e3e3ffULL, 0xc0c0c0c0e3e3e3ffULL, 0x80808080e3e3e3ffULL,
+	0x01010101e3e3e3ffULL, 0x03030303e3e3e3ffULL, 0x07070707e3e3e3ffULL, 0x0f0f0f0fe3e3e3ffULL,
+	0xf8f8f8ffe3e3e3ffULL, 0xf0f0f0ffe3e3e3ffULL, 0xe0e0e0ffe3e3e3ffULL, 0xc1c1c1ffe3e3e3ffULL,
+	0x838383ffe3e3e3ffULL, 0x070707ffe3e3e3ffULL, 0x0f0f0fffe3e3e3ffULL, 0x1f1f1fffe3e3e3ffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0f0f0fcfcULL, 0xfffffffcfcf8f8f8ULL, 0xfffff1f0f0f0f1f1ULL, 0xffc1c1c0c0c0e3e3ULL,
+	0x01010100000001c7ULL, 0x010101000000018fULL, 0x010101000000011fULL, 0x010101000000013fULL,
+	0xc0c0c0c0f0f0ffffULL, 0xfffcfdfcfcfcffffULL, 0xfff0f1f0f0f0f1ffULL, 0xc1c0c1c0c0c0c1ffULL,
+	0x01000100000001ffULL, 0x01000100000001ffULL, 0x01010100000001ffULL, 0x01010100000001ffULL,
+	0x0000000000000000ULL, 0xf8f8f8f8fcfcffffULL, 0xf0f0f0f0f0f0ffffULL, 0xc0c0c0c0c0c0ffffULL,
+	0x000000000000ffffULL, 0x000000000000ffffULL, 0x010101000000ffffULL, 0x030303000000ffffULL,
+	0xe0e0e0e0f0fcffffULL, 0xf0f0f0f8fcfcffffULL, 0xe0e0e0f0f0fcffffULL, 0xc0c0c0c0c0fcffffULL,
+	0x0000000000fcffffULL, 0x0101010000fcffffULL, 0x0303030000fcffffULL, 0x0707070404fcffffULL,
+	0xf0f0f0f0fcfcffffULL, 0xf0f0f0f0fcfcffffULL, 0xe0e0e0e0fcfcffffULL, 0xc1c0c0c0fcfcffffULL,
+	0x01010100fcfcffffULL, 0x03030300fcfcffffULL, 0x07070704fcfcffffULL, 0x0f0f0f0cfcfcffffULL,
+	0xf8f8f8fcfcfcffffULL, 0xf0f0f0fcfcfcffffULL, 0xe0e0e0fcfcfcffffULL, 0xc1c1c1fcfcfcffffULL,
+	0x838383fcfcfcffffULL, 0x070707fcfcfcffffULL, 0x0f0f0ffcfcfcffffULL, 0x1f1f1ffcfcfcffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0f8f8fcfcULL, 0xfffffff8f8f8f8f8ULL, 0xfffffff8f8f0f1f1ULL, 0xffffe3e0e0e0e3e3ULL,
+	0xff8383808080c7c7ULL, 0x030303000000038fULL, 0x030303000000031fULL, 0x010101000000033fULL,
+	0xc0c0c0c0f8f8ffffULL, 0xfff8faf8f8f8ffffULL, 0xfff8faf8f8f8ffffULL, 0xffe0e2e0e0e0e3ffULL,
+	0x83808280808083ffULL, 0x03000200000003ffULL, 0x03000200000003ffULL, 0x01010100000003ffULL,
+	0xc0c0c0c0f8f8ffffULL, 0x0000000000000000ULL, 0xf0f0f0f0f8f8ffffULL, 0xe0e0e0e0e0e0ffffULL,
+	0x808080808080ffffULL, 0x000000000000ffffULL, 0x010101000000ffffULL, 0x030303000000ffffULL,
+	0xe0e0e0e0f8f8ffffULL, 0xf0f0f0f8f8f8ffffULL, 0xe0e0e0f0f8f8ffffULL, 0xc0c0c0e0e0f8ffffULL,
+	0x8180808080f8ffffULL, 0x0101010000f8ffffULL, 0x0303030000f8ffffULL, 0x0707070000f8ffffULL,
+	0xf0f0f0f0f8f8ffffULL, 0xf0f0f0f0f8f8ffffULL, 0xe0e0e0e0f8f8ffffULL, 0xc1c0c0c0f8f8ffffULL,
+	0x83818180f8f8ffffULL, 0x03030300f8f8ffffULL, 0x07070700f8f8ffffULL, 0x0f0f0f08f8f8ffffULL,
+	0xf8f8f8f8f8f8ffffULL, 0xf0f0f0f8f8f8ffffULL, 0xe0e0e0f8f8f8ffffULL, 0xc1c1c1f8f8f8ffffULL,
+	0x838383f8f8f8ffffULL, 0x070707f8f8f8ffffULL, 0x0f0f0ff8f8f8ffffULL, 0x1f1f1ff8f8f8ffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0f0f0fcfcULL, 0xfffffff1f1f0f8f8ULL, 0xfffffff1f1f1f1f1ULL, 0xfffffff1f1e1e3e3ULL,
+	0xffffc7c1c1c1c7c7ULL, 0xff07070101018f8fULL, 0x070707010101071fULL, 0x010101010101073fULL,
+	0xc0c0c0c0f0f0fcffULL, 0xfff1f5f1f1f1ffffULL, 0xfff1f5f1f1f1ffffULL, 0xfff1f5f1f1f1ffffULL,
+	0xffc1c5c1c1c1c7ffULL, 0x07010501010107ffULL, 0x07010501010107ffULL, 0x01010101010107ffULL,
+	0xc0c0c0c0f0f0ffffULL, 0xf0f0f0f0f1f1ffffULL, 0x0000000000000000ULL, 0xe1e1e1e1f1f1ffffULL,
+	0xc1c1c1c1c1c1ffffULL, 0x010101010101ffffULL, 0x010101010101ffffULL, 0x030303010101ffffULL,
+	0xe0e0e0e0f0f1ffffULL, 0xe0e0e0e0f1f1ffffULL, 0xe0e0e0f1f1f1ffffULL, 0xc0c0c0e0f1f1ffffULL,
+	0x818181c1c1f1ffffULL, 0x0301010101f1ffffULL, 0x0303030101f1ffffULL, 0x0707070101f1ffffULL,
+	0xf0f0f0f0f1f1ffffULL, 0xf0f0f0f0f1f1ffffULL, 0xe0e0e0e0f1f1ffffULL, 0xc1c1c1c1f1f1ffffULL,
+	0x83818181f1f1ffffULL, 0x07030301f1f1ffffULL, 0x07070701f1f1ffffULL, 0x0f0f0f01f1f1ffffULL,
+	0xf8f8f8f1f1f1ffffULL, 0xf0f0f0f1f1f1ffffULL, 0xe0e0e0f1f1f1ffffULL, 0xc1c1c1f1f1f1ffffULL,
+	0x838383f1f1f1ffffULL, 0x070707f1f1f1ffffULL, 0x0f0f0ff1f1f1ffffULL, 0x1f1f1ff1f1f1ffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xc0c0c0c0e0e0fcfcULL, 0xfffff8e0e0e0f8f8ULL, 0xffffffe3e3e1f1f1ULL, 0xffffffe3e3e3e3e3ULL,
+	0xffffffe3e3c3c7c7ULL, 0xffff8f8383838f8fULL, 0xff0f0f0303031f1fULL, 0x0303030303030f3fULL,
+	0xc0c0c0c0e0e0f8ffULL, 0xffe0e8e0e0e0f8ffULL, 0xffe3ebe3e3e3ffffULL, 0xffe3ebe3e3e3ffffULL,
+	0xffe3ebe3e3e3ffffULL, 0xff838b8383838fffULL, 0x0f030b0303030fffULL, 0x0303030303030fffULL,
+	0xc0c0c0c0e0e0ffffULL, 0xe0e0e0e0e0e0ffffULL, 0xe1e1e1e1e3e3ffffULL, 0x0000000000000000ULL,
+	0xc3c3c3c3e3e3ffffULL, 0x838383838383ffffULL, 0x030303030303ffffULL, 0x030303030303ffffULL,
+	0xe0e0e0e0e0e3ffffULL, 0xe0e0e0e0e0e3ffffULL, 0xc0c0c0c1e3e3ffffULL, 0xc1c1c1e3e3e3ffffULL,
+	0x818181c1e3e3ffffULL, 0x0303038383e3ffffULL, 0x0703030303e3ffffULL, 0x0707070303e3ffffULL,
+	0xf0f0f0e0e3e3ffffULL, 0xf0e0e0e0e3e3ffffULL, 0xe0e0e0e0e3e3ffffULL, 0xc1c1c1c1e3e3ffffULL,
+	0x83838383e3e3ffffULL, 0x07030303e3e3ffffULL, 0x0f070703e3e3ffffULL, 0x0f0f0f03e3e3ffffULL,
+	0xf8f8f8e3e3e3ffffULL, 0xf0f0f0e3e3e3ffffULL, 0xe0e0e0e3e3e3ffffULL, 0xc1c1c1e3e3e3ffffULL,
+	0x838383e3e3e3ffffULL, 0x070707e3e3e3ffffULL, 0x0f0f0fe3e3e3ffffULL, 0x1f1f1fe3e3e3ffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xe0e0e0f0f0f0fcfcULL, 0xfffffcfcf8f8f8f8ULL, 0xfffff0f0f0f1f1f1ULL, 0xffc1c0c0c0c1e3e3ULL,
+	0x01010000000101c7ULL, 0x010100000001018fULL, 0x010100000001011fULL, 0x010100000001013fULL,
+	0xe0e0e0f0f0f0fcffULL, 0xfffffcfcf8f8f8ffULL, 0xfff1f0f0f0f0f0ffULL, 0xc1c1c0c0c0c0c0ffULL,
+	0x01010000000000ffULL, 0x01010000000000ffULL, 0x01010000000000ffULL, 0x01010000000101ffULL,
+	0xe0e0e0f0f0ffffffULL, 0xfcfdfcfcfcffffffULL, 0xf0f1f0f0f0f1ffffULL, 0xc0c1c0c0c0c1ffffULL,
+	0x000100000001ffffULL, 0x010100000001ffffULL, 0x010100000001ffffULL, 0x030300000003ffffULL,
+	0x0000000000000000ULL, 0xf8f8f8fcfcffffffULL, 0xf0f0f0f0f0ffffffULL, 0xc0c0c0c0c0ffffffULL,
+	0x0000000000ffffffULL, 0x0101000000ffffffULL, 0x0303000000ffffffULL, 0x0707040404ffffffULL,
+	0xf0f0f0f0fcffffffULL, 0xf8f8f8fcfcffffffULL, 0xf1f1f0f0fcffffffULL, 0xc1c1c0c0fcffffffULL,
+	0x01010000fcffffffULL, 0x03030000fcffffffULL, 0x07070404fcffffffULL, 0x0f0f0c0cfcffffffULL,
+	0xf8f8f8fcfcffffffULL, 0xf0f0f0fcfcffffffULL, 0xe0e0e0fcfcffffffULL, 0xc1c1c0fcfcffffffULL,
+	0x838380fcfcffffffULL, 0x070704fcfcffffffULL, 0x0f0f0cfcfcffffffULL, 0x1f1f1cfcfcffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xe0e0e0f8f8fcfcfcULL, 0xfffff8f8f8f8f8f8ULL, 0xfffff8f8f0f1f1f1ULL, 0xffffe0e0e0e3e3e3ULL,
+	0xff8380808083c7c7ULL, 0x030300000003038fULL, 0x030300000003031fULL, 0x010100000003033fULL,
+	0xe0e0e0f8f8fcfcffULL, 0xfffff8f8f8f8f8ffULL, 0xfffff8f8f0f1f1ffULL, 0xffe3e0e0e0e1e1ffULL,
+	0x83838080808181ffULL, 0x03030000000101ffULL, 0x03030000000101ffULL, 0x01010000000101ffULL,
+	0xe0e0e0f8f8ffffffULL, 0xf8faf8f8f8ffffffULL, 0xf8faf8f8f8ffffffULL, 0xe0e2e0e0e0e3ffffULL,
+	0x808280808083ffffULL, 0x000200000003ffffULL, 0x030300000003ffffULL, 0x030300000003ffffULL,
+	0xe0e0e0f8f8ffffffULL, 0x0000000000000000ULL, 0xf0f0f0f8f8ffffffULL, 0xe1e1e0e0e0ffffffULL,
+	0x8181808080ffffffULL, 0x0101000000ffffffULL, 0x0303000000ffffffULL, 0x0707000000ffffffULL,
+	0xf0f0f0f8f8ffffffULL, 0xf8f8f8f8f8ffffffULL, 0xf1f1f0f8f8ffffffULL, 0xe3e3e0e0f8ffffffULL,
+	0x83838080f8ffffffULL, 0x03030000f8ffffffULL, 0x07070000f8ffffffULL, 0x0f0f0808f8ffffffULL,
+	0xf8f8f8f8f8ffffffULL, 0xf0f0f0f8f8ffffffULL, 0xe0e0e0f8f8ffffffULL, 0xc1c1c0f8f8ffffffULL,
+	0x838380f8f8ffffffULL, 0x070700f8f8ffffffULL, 0x0f0f08f8f8ffffffULL, 0x1f1f18f8f8ffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xe0e0e0f0f0fcfcfcULL, 0xfffff1f1f0f8f8f8ULL, 0xfffff1f1f1f1f1f1ULL, 0xfffff1f1e1e3e3e3ULL,
+	0xffffc1c1c1c7c7c7ULL, 0xff07010101078f8fULL, 0x070701010107071fULL, 0x010101010107073fULL,
+	0xe0e0e0f0f0f8f8ffULL, 0xfffff1f1f0f8f8ffULL, 0xfffff1f1f1f1f1ffULL, 0xfffff1f1e1e3e3ffULL,
+	0xffc7c1c1c1c3c3ffULL, 0x07070101010303ffULL, 0x07070101010303ffULL, 0x01010101010303ffULL,
+	0xe0e0e0f0f0fcffffULL, 0xf1f5f1f1f1ffffffULL, 0xf1f5f1f1f1ffffffULL, 0xf1f5f1f1f1ffffffULL,
+	0xc1c5c1c1c1c7ffffULL, 0x010501010107ffffULL, 0x010501010107ffffULL, 0x030301010107ffffULL,
+	0xe0e0e0f0f0ffffffULL, 0xf0f0f0f1f1ffffffULL, 0x0000000000000000ULL, 0xe1e1e1f1f1ffffffULL,
+	0xc3c3c1c1c1ffffffULL, 0x0303010101ffffffULL, 0x0303010101ffffffULL, 0x0707010101ffffffULL,
+	0xf0f0f0f0f1ffffffULL, 0xf8f8f0f1f1ffffffULL, 0xf1f1f1f1f1ffffffULL, 0xe3e3e1f1f1ffffffULL,
+	0xc7c7c1c1f1ffffffULL, 0x07070101f1ffffffULL, 0x07070101f1ffffffULL, 0x0f0f0101f1ffffffULL,
+	0xf8f8f0f1f1ffffffULL, 0xf0f0f0f1f1ffffffULL, 0xe0e0e0f1f1ffffffULL, 0xc1c1c1f1f1ffffffULL,
+	0x838381f1f1ffffffULL, 0x070701f1f1ffffffULL, 0x0f0f01f1f1ffffffULL, 0x1f1f11f1f1ffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xe0e0e0e0e0f8fcfcULL, 0xffffe0e0e0f8f8f8ULL, 0xffffe3e3e1f1f1f1ULL, 0xffffe3e3e3e3e3e3ULL,
+	0xffffe3e3c3c7c7c7ULL, 0xffff8383838f8f8fULL, 0xff0f0303030f1f1fULL, 0x03030303030f0f3fULL,
+	0xe0e0e0e0e0f0f0ffULL, 0xfff8e0e0e0f0f0ffULL, 0xffffe3e3e1f1f1ffULL, 0xffffe3e3e3e3e3ffULL,
+	0xffffe3e3c3c7c7ffULL, 0xff8f8383838787ffULL, 0x0f0f0303030707ffULL, 0x03030303030707ffULL,
+	0xe0e0e0e0e0f8ffffULL, 0xe0e8e0e0e0f8ffffULL, 0xe3ebe3e3e3ffffffULL, 0xe3ebe3e3e3ffffffULL,
+	0xe3ebe3e3e3ffffffULL, 0x838b8383838fffffULL, 0x030b0303030fffffULL, 0x03030303030fffffULL,
+	0xe0e0e0e0e0ffffffULL, 0xf0f0e0e0e0ffffffULL, 0xe1e1e1e3e3ffffffULL, 0x0000000000000000ULL,
+	0xc3c3c3e3e3ffffffULL, 0x8787838383ffffffULL, 0x0707030303ffffffULL, 0x0707030303ffffffULL,
+	0xf0f0e0e0e3ffffffULL, 0xf8f8e0e0e3ffffffULL, 0xf1f1e1e3e3ffffffULL, 0xe3e3e3e3e3ffffffULL,
+	0xc7c7c3e3e3ffffffULL, 0x8f8f8383e3ffffffULL, 0x0f0f0303e3ffffffULL, 0x0f0f0303e3ffffffULL,
+	0xf8f8e0e3e3ffffffULL, 0xf0f0e0e3e3ffffffULL, 0xe0e0e0e3e3ffffffULL, 0xc1c1c1e3e3ffffffULL,
+	0x838383e3e3ffffffULL, 0x070703e3e3ffffffULL, 0x0f0f03e3e3ffffffULL, 0x1f1f03e3e3ffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0f0f0f0f0f0fcfcULL, 0xfffcfcf0f0f0f8f8ULL, 0xfff0f0e0e0e0f1f1ULL, 0xffc0c0c0c0c0e3e3ULL,
+	0x01000000000001c7ULL, 0x010000000000018fULL, 0x010000000000011fULL, 0x010000000101013fULL,
+	0xf0f0f0f0f0f0f8ffULL, 0xfffcfcf8f0f0f0ffULL, 0xfff0f0f0e0e0e0ffULL, 0xc1c0c0c0c0c0c0ffULL,
+	0x01000000000000ffULL, 0x01000000000000ffULL, 0x01000000000000ffULL, 0x01000000010101ffULL,
+	0xf0f0f0f0f0fcffffULL, 0xfffcfcf8f8f8ffffULL, 0xf1f0f0f0f0f0ffffULL, 0xc1c0c0c0c0c0ffffULL,
+	0x010000000000ffffULL, 0x010000000000ffffULL, 0x010000000101ffffULL, 0x030000000303ffffULL,
+	0xf0f0f0f0ffffffffULL, 0xfffcfcfcffffffffULL, 0xf1f0f0f0f1ffffffULL, 0xc1c0c0c0c1ffffffULL,
+	0x0100000001ffffffULL, 0x0100000001ffffffULL, 0x0300000003ffffffULL, 0x0704040407ffffffULL,
+	0x0000000000000000ULL, 0xfdfcfcfcffffffffULL, 0xf1f0f0f0ffffffffULL, 0xc1c0c0c0ffffffffULL,
+	0x01000000ffffffffULL, 0x03000000ffffffffULL, 0x07040404ffffffffULL, 0x0f0c0c0cffffffffULL,
+	0xfcfcfcfcffffffffULL, 0xfaf8fcfcffffffffULL, 0xf0f0f0fcffffffffULL, 0xc1c0c0fcffffffffULL,
+	0x838080fcffffffffULL, 0x070404fcffffffffULL, 0x0f0c0cfcffffffffULL, 0x1f1c1cfcffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0f0f8f8f8f8fcfcULL, 0xfff8f8f0f0f0f8f8ULL, 0xfff8f8e0e0e0f1f1ULL, 0xffe0e0c0c0c0e3e3ULL,
+	0xff8080808080c7c7ULL, 0x030000000000038fULL, 0x030000000000031fULL, 0x010000000101033fULL,
+	0xf0f0f8f8f8f8f8ffULL, 0xfff8f8f8f0f0f0ffULL, 0xfff8f8f0e0e0e0ffULL, 0xffe0e0e0c0c0c1ffULL,
+	0x83808080808081ffULL, 0x03000000000001ffULL, 0x03000000000001ffULL, 0x01000000010101ffULL,
+	0xf0f0f8f8fcfcffffULL, 0xfff8f8f8f8f8ffffULL, 0xfff8f8f0f1f1ffffULL, 0xe3e0e0e0e1e1ffffULL,
+	0x838080808181ffffULL, 0x030000000101ffffULL, 0x030000000101ffffULL, 0x030000000303ffffULL,
+	0xf0f0f8f8ffffffffULL, 0xfff8f8f8ffffffffULL, 0xfff8f8f8ffffffffULL, 0xe3e0e0e0e3ffffffULL,
+	0x8380808083ffffffULL, 0x0300000003ffffffULL, 0x0300000003ffffffULL, 0x0700000007ffffffULL,
+	0xf8f8f8f8ffffffffULL, 0x0000000000000000ULL, 0xfaf8f8f8ffffffffULL, 0xe3e0e0e0ffffffffULL,
+	0x83808080ffffffffULL, 0x03000000ffffffffULL, 0x07000000ffffffffULL, 0x0f080808ffffffffULL,
+	0xfcf8f8f8ffffffffULL, 0xfdf8f8f8ffffffffULL, 0xf4f0f8f8ffffffffULL, 0xe3e0e0f8ffffffffULL,
+	0x838080f8ffffffffULL, 0x070000f8ffffffffULL, 0x0f0808f8ffffffffULL, 0x1f1818f8ffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0f0f0f0f0f0fcfcULL, 0xfff1f1f0f0f0f8f8ULL, 0xfff1f1e0e0e0f1f1ULL, 0xfff1f1c1c1c1e3e3ULL,
+	0xffc1c1818181c7c7ULL, 0xff01010101018f8fULL, 0x070101010101071fULL, 0x010101010101073fULL,
+	0xf0f0f0f0f0f0f8ffULL, 0xfff1f1f0f0f0f0ffULL, 0xfff1f1f1e0e0e0ffULL, 0xfff1f1e1c1c1c1ffULL,
+	0xffc1c1c1818183ffULL, 0x07010101010103ffULL, 0x07010101010103ffULL, 0x01010101010103ffULL,
+	0xf0f0f0f0f8f8ffffULL, 0xfff1f1f0f8f8ffffULL, 0xfff1f1f1f1f1ffffULL, 0xfff1f1e1e3e3ffffULL,
+	0xc7c1c1c1c3c3ffffULL, 0x070101010303ffffULL, 0x070101010303ffffULL, 0x030101010303ffffULL,
+	0xf0f0f0f0fcffffffULL, 0xfff1f1f1ffffffffULL, 0xfff1f1f1ffffffffULL, 0xfff1f1f1ffffffffULL,
+	0xc7c1c1c1c7ffffffULL, 0x0701010107ffffffULL, 0x0701010107ffffffULL, 0x0701010107ffffffULL,
+	0xf8f0f0f0ffffffffULL, 0xf5f0f1f1ffffffffULL, 0x0000000000000000ULL, 0xf5f1f1f1ffffffffULL,
+	0xc7c1c1c1ffffffffULL, 0x07010101ffffffffULL, 0x07010101ffffffffULL, 0x0f010101ffffffffULL,
+	0xfcf0f0f1ffffffffULL, 0xfaf0f1f1ffffffffULL, 0xfbf1f1f1ffffffffULL, 0xebe1f1f1ffffffffULL,
+	0xc7c1c1f1ffffffffULL, 0x070101f1ffffffffULL, 0x0f0101f1ffffffffULL, 0x1f1111f1ffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xe0e0e0e0e0e0fcfcULL, 0xffe0e0e0e0e0f8f8ULL, 0xffe3e3e0e0e0f1f1ULL, 0xffe3e3c1c1c1e3e3ULL,
+	0xffe3e3838383c7c7ULL, 0xff83830303038f8fULL, 0xff03030303031f1fULL, 0x0303030303030f3fULL,
+	0xe0e0e0e0e0e0f0ffULL, 0xffe0e0e0e0e0f0ffULL, 0xffe3e3e1e0e0e0ffULL, 0xffe3e3e3c1c1c1ffULL,
+	0xffe3e3c3838383ffULL, 0xff838383030307ffULL, 0x0f030303030307ffULL, 0x03030303030307ffULL,
+	0xe0e0e0e0f0f0ffffULL, 0xf8e0e0e0f0f0ffffULL, 0xffe3e3e1f1f1ffffULL, 0xffe3e3e3e3e3ffffULL,
+	0xffe3e3c3c7c7ffffULL, 0x8f8383838787ffffULL, 0x0f0303030707ffffULL, 0x030303030707ffffULL,
+	0xe0e0e0e0f8ffffffULL, 0xf8e0e0e0f8ffffffULL, 0xffe3e3e3ffffffffULL, 0xffe3e3e3ffffffffULL,
+	0xffe3e3e3ffffffffULL, 0x8f8383838fffffffULL, 0x0f0303030fffffffULL, 0x070303030fffffffULL,
+	0xf0e0e0e0ffffffffULL, 0xf8e0e0e0ffffffffULL, 0xebe3e3e3ffffffffULL, 0x0000000000000000ULL,
+	0xebe3e3e3ffffffffULL, 0x8f838383ffffffffULL, 0x0f030303ffffffffULL, 0x0f030303ffffffffULL,
+	0xf8e0e0e3ffffffffULL, 0xf8e0e0e3ffffffffULL, 0xf5e1e3e3ffffffffULL, 0xf7e3e3e3ffffffffULL,
+	0xd7c3e3e3ffffffffULL, 0x8f8383e3ffffffffULL, 0x0f0303e3ffffffffULL, 0x1f0303e3ffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0f0f0f0f0f0f0fcULL, 0xfcfce0e0e0e0e0f8ULL, 0xf0f0c0c0c0c0c0f1ULL, 0xc0c08080808080e3ULL,
+	0x00000000000000c7ULL, 0x000000000000008fULL, 0x000000000000001fULL, 0x000000010101013fULL,
+	0xf0f0f0f0f0f0f0ffULL, 0xfcfcf0e0e0e0e0ffULL, 0xf0f0e0c0c0c0c0ffULL, 0xc0c0c080808080ffULL,
+	0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000001010101ffULL,
+	0xf0f0f0f0f0f8ffffULL, 0xfcfcf8f0f0f0ffffULL, 0xf0f0f0e0e0e0ffffULL, 0xc0c0c0c0c0c0ffffULL,
+	0x000000000000ffffULL, 0x000000000000ffffULL, 0x000000010101ffffULL, 0x000000030303ffffULL,
+	0xf0f0f0f0fcffffffULL, 0xfcfcf8f8f8ffffffULL, 0xf0f0f0f0f0ffffffULL, 0xc0c0c0c0c0ffffffULL,
+	0x0000000000ffffffULL, 0x0000000101ffffffULL, 0x0000000303ffffffULL, 0x0404040707ffffffULL,
+	0xf0f0f0ffffffffffULL, 0xfcfcfcffffffffffULL, 0xf0f0f0f1ffffffffULL, 0xc0c0c0c1ffffffffULL,
+	0x00000001ffffffffULL, 0x00000003ffffffffULL, 0x04040407ffffffffULL, 0x0c0c0c0fffffffffULL,
+	0x0000000000000000ULL, 0xfcfcfcffffffffffULL, 0xf0f0f0ffffffffffULL, 0xc0c0c0ffffffffffULL,
+	0x808080ffffffffffULL, 0x040404ffffffffffULL, 0x0c0c0cffffffffffULL, 0x1c1c1cffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf8f8f0f0f0f0f0fcULL, 0xf8f8e0e0e0e0e0f8ULL, 0xf8f8c0c0c0c0c0f1ULL, 0xe0e08080808080e3ULL,
+	0x80800000000000c7ULL, 0x000000000000008fULL, 0x000000000000001fULL, 0x000000010101013fULL,
+	0xf8f8f0f0f0f0f0ffULL, 0xf8f8f0e0e0e0e0ffULL, 0xf8f8e0c0c0c0c0ffULL, 0xe0e0c080808080ffULL,
+	0x80808000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000001010101ffULL,
+	0xf8f8f8f8f8f8ffffULL, 0xf8f8f8f0f0f0ffffULL, 0xf8f8f0e0e0e0ffffULL, 0xe0e0e0c0c0c1ffffULL,
+	0x808080808081ffffULL, 0x000000000001ffffULL, 0x000000010101ffffULL, 0x000000030303ffffULL,
+	0xf8f8f8fcfcffffffULL, 0xf8f8f8f8f8ffffffULL, 0xf8f8f0f1f1ffffffULL, 0xe0e0e0e1e1ffffffULL,
+	0x8080808181ffffffULL, 0x0000000101ffffffULL, 0x0000000303ffffffULL, 0x0000000707ffffffULL,
+	0xf8f8f8ffffffffffULL, 0xf8f8f8ffffffffffULL, 0xf8f8f8ffffffffffULL, 0xe0e0e0e3ffffffffULL,
+	0x80808083ffffffffULL, 0x00000003ffffffffULL, 0x00000007ffffffffULL, 0x0808080fffffffffULL,
+	0xf8f8f8ffffffffffULL, 0x0000000000000000ULL, 0xf8f8f8ffffffffffULL, 0xe0e0e0ffffffffffULL,
+	0x808080ffffffffffULL, 0x000000ffffffffffULL, 0x080808ffffffffffULL, 0x181818ffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0f0f0f0f0f0f0fcULL, 0xf1f1e0e0e0e0e0f8ULL, 0xf1f1c0c0c0c0c0f1ULL, 0xf1f18080808080e3ULL,
+	0xc1c10101010101c7ULL, 0x010101010101018fULL, 0x010101010101011fULL, 0x010101010101013fULL,
+	0xf0f0f0f0f0f0f0ffULL, 0xf1f1f0e0e0e0e0ffULL, 0xf1f1e0c0c0c0c0ffULL, 0xf1f1c180808080ffULL,
+	0xc1c18101010101ffULL, 0x01010101010101ffULL, 0x01010101010101ffULL, 0x01010101010101ffULL,
+	0xf0f0f0f0f0f8ffffULL, 0xf1f1f0f0f0f0ffffULL, 0xf1f1f1e0e0e0ffffULL, 0xf1f1e1c1c1c1ffffULL,
+	0xc1c1c1818183ffffULL, 0x010101010103ffffULL, 0x010101010103ffffULL, 0x010101030303ffffULL,
+	0xf0f0f0f8f8ffffffULL, 0xf1f1f0f8f8ffffffULL, 0xf1f1f1f1f1ffffffULL, 0xf1f1e1e3e3ffffffULL,
+	0xc1c1c1c3c3ffffffULL, 0x0101010303ffffffULL, 0x0101010303ffffffULL, 0x0101010707ffffffULL,
+	0xf0f0f0fcffffffffULL, 0xf0f1f1ffffffffffULL, 0xf1f1f1ffffffffffULL, 0xf1f1f1ffffffffffULL,
+	0xc1c1c1c7ffffffffULL, 0x01010107ffffffffULL, 0x01010107ffffffffULL, 0x0101010fffffffffULL,
+	0xf0f0f0ffffffffffULL, 0xf1f1f1ffffffffffULL, 0x0000000000000000ULL, 0xf1f1f1ffffffffffULL,
+	0xc1c1c1ffffffffffULL, 0x010101ffffffffffULL, 0x010101ffffffffffULL, 0x111111ffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xe0e0e0e0e0e0e0fcULL, 0xe0e0e0e0e0e0e0f8ULL, 0xe3e3c0c0c0c0c0f1ULL, 0xe3e38080808080e3ULL,
+	0xe3e30101010101c7ULL, 0x838303030303038fULL, 0x030303030303031fULL, 0x030303030303033fULL,
+	0xe0e0e0e0e0e0e0ffULL, 0xe0e0e0e0e0e0e0ffULL, 0xe3e3e0c0c0c0c0ffULL, 0xe3e3c180808080ffULL,
+	0xe3e38301010101ffULL, 0x83830303030303ffULL, 0x03030303030303ffULL, 0x03030303030303ffULL,
+	0xe0e0e0e0e0f0ffffULL, 0xe0e0e0e0e0f0ffffULL, 0xe3e3e1e0e0e0ffffULL, 0xe3e3e3c1c1c1ffffULL,
+	0xe3e3c3838383ffffULL, 0x838383030307ffffULL, 0x030303030307ffffULL, 0x030303030307ffffULL,
+	0xe0e0e0f0f0ffffffULL, 0xe0e0e0f0f0ffffffULL, 0xe3e3e1f1f1ffffffULL, 0xe3e3e3e3e3ffffffULL,
+	0xe3e3c3c7c7ffffffULL, 0x8383838787ffffffULL, 0x0303030707ffffffULL, 0x0303030707ffffffULL,
+	0xe0e0e0f8ffffffffULL, 0xe0e0e0f8ffffffffULL, 0xe3e3e3ffffffffffULL, 0xe3e3e3ffffffffffULL,
+	0xe3e3e3ffffffffffULL, 0x8383838fffffffffULL, 0x0303030fffffffffULL, 0x0303030fffffffffULL,
+	0xe0e0e0ffffffffffULL, 0xe0e0e0ffffffffffULL, 0xe3e3e3ffffffffffULL, 0x0000000000000000ULL,
+	0xe3e3e3ffffffffffULL, 0x838383ffffffffffULL, 0x030303ffffffffffULL, 0x030303ffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0e0e0e0e0e0e0fcULL, 0xfcc0c0c0c0c0c0f8ULL, 0xf0808080808080f1ULL, 0xc0000000000000e3ULL,
+	0x00000000000000c7ULL, 0x000000000000008fULL, 0x000000000000001fULL, 0x000001010101013fULL,
+	0xf0e0e0e0e0e0e0ffULL, 0xfce0c0c0c0c0c0ffULL, 0xf0c08080808080ffULL, 0xc0800000000000ffULL,
+	0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000101010101ffULL,
+	0xf0f0f0f0f0f0ffffULL, 0xfcf0e0e0e0e0ffffULL, 0xf0e0c0c0c0c0ffffULL, 0xc0c080808080ffffULL,
+	0x000000000000ffffULL, 0x000000000000ffffULL, 0x000001010101ffffULL, 0x000003030303ffffULL,
+	0xf0f0f0f0f8ffffffULL, 0xfcf8f0f0f0ffffffULL, 0xf0f0e0e0e0ffffffULL, 0xc0c0c0c0c0ffffffULL,
+	0x0000000000ffffffULL, 0x0000010101ffffffULL, 0x0000030303ffffffULL, 0x0404070707ffffffULL,
+	0xf0f0f0f8ffffffffULL, 0xfcf8f8f8ffffffffULL, 0xf0f0f0f0ffffffffULL, 0xc0c0c0c0ffffffffULL,
+	0x00000101ffffffffULL, 0x00000303ffffffffULL, 0x04040707ffffffffULL, 0x0c0c0f0fffffffffULL,
+	0xf0f0f1ffffffffffULL, 0xfcfcffffffffffffULL, 0xf0f0f1ffffffffffULL, 0xc0c0c1ffffffffffULL,
+	0x808083ffffffffffULL, 0x040407ffffffffffULL, 0x0c0c0fffffffffffULL, 0x1c1c1fffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf8e0e0e0e0e0e0fcULL, 0xf8c0c0c0c0c0c0f8ULL, 0xf8808080808080f1ULL, 0xe0000000000000e3ULL,
+	0x80000000000000c7ULL, 0x000000000000008fULL, 0x000000000000001fULL, 0x000001010101013fULL,
+	0xf8e0e0e0e0e0e0ffULL, 0xf8e0c0c0c0c0c0ffULL, 0xf8c08080808080ffULL, 0xe0800000000000ffULL,
+	0x80000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000101010101ffULL,
+	0xf8f0f0f0f0f0ffffULL, 0xf8f0e0e0e0e0ffffULL, 0xf8e0c0c0c0c0ffffULL, 0xe0c080808080ffffULL,
+	0x808000000000ffffULL, 0x000000000000ffffULL, 0x000001010101ffffULL, 0x000003030303ffffULL,
+	0xf8f8f8f8f8ffffffULL, 0xf8f8f0f0f0ffffffULL, 0xf8f0e0e0e0ffffffULL, 0xe0e0c0c0c1ffffffULL,
+	0x8080808081ffffffULL, 0x0000010101ffffffULL, 0x0000030303ffffffULL, 0x0000070707ffffffULL,
+	0xf8f8fcfcffffffffULL, 0xf8f8f8f8ffffffffULL, 0xf8f0f1f1ffffffffULL, 0xe0e0e1e1ffffffffULL,
+	0x80808181ffffffffULL, 0x00000303ffffffffULL, 0x00000707ffffffffULL, 0x08080f0fffffffffULL,
+	0xf8f8ffffffffffffULL, 0xf8f8ffffffffffffULL, 0xf8f8ffffffffffffULL, 0xe0e0e3ffffffffffULL,
+	0x808083ffffffffffULL, 0x000007ffffffffffULL, 0x08080fffffffffffULL, 0x18181fffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xf0e0e0e0e0e0e0fcULL, 0xf1c0c0c0c0c0c0f8ULL, 0xf1808080808080f1ULL, 0xf1000000000000e3ULL,
+	0xc1000000000000c7ULL, 0x010101010101018fULL, 0x010101010101011fULL, 0x010101010101013fULL,
+	0xf0e0e0e0e0e0e0ffULL, 0xf1e0c0c0c0c0c0ffULL, 0xf1c08080808080ffULL, 0xf1800000000000ffULL,
+	0xc1010000000000ffULL, 0x01010101010101ffULL, 0x01010101010101ffULL, 0x01010101010101ffULL,
+	0xf0f0f0f0f0f0ffffULL, 0xf1f0e0e0e0e0ffffULL, 0xf1e0c0c0c0c0ffffULL, 0xf1c180808080ffffULL,
+	0xc18101010101ffffULL, 0x010101010101ffffULL, 0x010101010101ffffULL, 0x010103030303ffffULL,
+	0xf0f0f0f0f8ffffffULL, 0xf1f0f0f0f0ffffffULL, 0xf1f1e0e0e0ffffffULL, 0xf1e1c1c1c1ffffffULL,
+	0xc1c1818183ffffffULL, 0x0101010103ffffffULL, 0x0101030303ffffffULL, 0x0101070707ffffffULL,
+	0xf0f0f8f8ffffffffULL, 0xf0f0f8f8ffffffffULL, 0xf1f1f1f1ffffffffULL, 0xf1e1e3e3ffffffffULL,
+	0xc1c1c3c3ffffffffULL, 0x01010303ffffffffULL, 0x01010707ffffffffULL, 0x01010f0fffffffffULL,
+	0xf0f0fcffffffffffULL, 0xf1f1ffffffffffffULL, 0xf1f1ffffffffffffULL, 0xf1f1ffffffffffffULL,
+	0xc1c1c7ffffffffffULL, 0x010107ffffffffffULL, 0x01010fffffffffffULL, 0x11111fffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0xe0e0e0e0e0e0e0fcULL, 0xe0c0c0c0c0c0c0f8ULL, 0xe3808080808080f1ULL, 0xe3000000000000e3ULL,
+	0xe3000000000000c7ULL, 0x830101010101018fULL, 0x030303030303031fULL, 0x030303030303033fULL,
+	0xe0e0e0e0e0e0e0ffULL, 0xe0e0c0c0c0c0c0ffULL, 0xe3c08080808080ffULL, 0xe3800000000000ffULL,
+	0xe3010000000000ffULL, 0x83030101010101ffULL, 0x03030303030303ffULL, 0x03030303030303ffULL,
+	0xe0e0e0e0e0e0ffffULL, 0xe0e0e0e0e0e0ffffULL, 0xe3e0c0c0c0c0ffffULL, 0xe3c180808080ffffULL,
+	0xe38301010101ffffULL, 0x830303030303ffffULL, 0x030303030303ffffULL, 0x030303030303ffffULL,
+	0xe0e0e0e0f0ffffffULL, 0xe0e0e0e0f0ffffffULL, 0xe3e1e0e0e0ffffffULL, 0xe3e3c1c1c1ffffffULL,
+	0xe3c3838383ffffffULL, 0x8383030307ffffffULL, 0x0303030307ffffffULL, 0x0303070707ffffffULL,
+	0xe0e0f0f0ffffffffULL, 0xe0e0f0f0ffffffffULL, 0xe3e1f1f1ffffffffULL, 0xe3e3e3e3ffffffffULL,
+	0xe3c3c7c7ffffffffULL, 0x83838787ffffffffULL, 0x03030707ffffffffULL, 0x03030f0fffffffffULL,
+	0xe0e0f8ffffffffffULL, 0xe0e0f8ffffffffffULL, 0xe3e3ffffffffffffULL, 0xe3e3ffffffffffffULL,
+	0xe3e3ffffffffffffULL, 0x83838fffffffffffULL, 0x03030fffffffffffULL, 0x03031fffffffffffULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+};
@@ -1,4 +1,9 @@
 #include "Magic.hpp"
+#include "Time.hpp"
+
+#include <random>
+#include <vector>
+
 
 /* 
     Both relevant bits and magic bitboards, as also relevant occupancy masks
@@ -7,7 +12,7 @@
     There are taken directly from Austerlitz source code.
 */
 
-std::array<uint64_t, 64> SlidersMagics::_magics_bishop = {
+constexpr std::array<uint64_t, 64> SlidersMagics::_magics_bishop = {
     0xd0100150140149c2,0x400b4a8fe1010031,0x480a1420200000,0x12c8204840c98020,0x284050484ca00c2,
     0x2006082494118828,0x8c02020282410320,0x24401208140c2408,0x30c060a0220a3845,0x5458108248004488,
     0x70980404440048b8,0xa41040512093810,0x11020c0308012920,0x4a02011002114209,0x8d0a090a4304090,
@@ -23,7 +28,7 @@ std::array<uint64_t, 64> SlidersMagics::_magics_bishop = {
     0x115571440283201,0xa90084202212ca00,0x804a042048123092,0x838e00408820010,
 };
 
-std::array<uint64_t, 64> SlidersMagics::_magics_rook = {
+constexpr std::array<uint64_t, 64> SlidersMagics::_magics_rook = {
     0x188001a080400431,0x8140002002401000,0x49000852600101c1,0x1900100021281500,0x9a0022005c0810a0,
     0x300082400020100,0xe0002000110c418,0x200048a05462104,0x4562801140008320,0x6489404010002000,
     0x8039002000401101,0x1309001000492104,0xe109800400080082,0x48a000442000950,0x720400101c810248,
@@ -39,7 +44,7 @@ std::array<uint64_t, 64> SlidersMagics::_magics_rook = {
     0x512001c200830aa,0x448a00140805501a,0x944302802008104,0x28811300442c0082,
 };
 
-std::array<uint64_t, 64> SlidersMagics::_m_occupancy_bishop = {
+constexpr std::array<uint64_t, 64> SlidersMagics::_m_occupancy_bishop = {
     0x40201008040200,0x402010080400,0x4020100a00,0x40221400,0x2442800,0x204085000,0x20408102000,0x2040810204000,
     0x20100804020000,0x40201008040000,0x4020100a0000,0x4022140000,0x244280000,0x20408500000,0x2040810200000,
     0x4081020400000,0x10080402000200,0x20100804000400,0x4020100a000a00,0x402214001400,0x24428002800,0x2040850005000,
@@ -51,7 +56,7 @@ std::array<uint64_t, 64> SlidersMagics::_m_occupancy_bishop = {
     0xa102040000000,0x14224000000000,0x28440200000000,0x50080402000000,0x20100804020000,0x40201008040200,
 };
 
-std::array<uint64_t, 64> SlidersMagics::_m_occupancy_rook = {
+constexpr std::array<uint64_t, 64> SlidersMagics::_m_occupancy_rook = {
     0x101010101017e,0x202020202027c,0x404040404047a,0x8080808080876,0x1010101010106e,0x2020202020205e,
     0x4040404040403e,0x8080808080807e,0x1010101017e00,0x2020202027c00,0x4040404047a00,0x8080808087600,
     0x10101010106e00,0x20202020205e00,0x40404040403e00,0x80808080807e00,0x10101017e0100,0x20202027c0200,
@@ -65,7 +70,7 @@ std::array<uint64_t, 64> SlidersMagics::_m_occupancy_rook = {
     0x7608080808080800,0x6e10101010101000,0x5e20202020202000,0x3e40404040404000,0x7e80808080808000,
 };
 
-std::array<int, 64> SlidersMagics::_m_bits_bishop = {
+constexpr std::array<int, 64> SlidersMagics::_m_bits_bishop = {
     6,5,5,5,5,5,5,6,
     5,5,5,5,5,5,5,5,
     5,5,7,7,7,7,5,5,
@@ -76,7 +81,7 @@ std::array<int, 64> SlidersMagics::_m_bits_bishop = {
     6,5,5,5,5,5,5,6,
 };
 
-std::array<int, 64> SlidersMagics::_m_bits_rook = {
+constexpr std::array<int, 64> SlidersMagics::_m_bits_rook = {
     12,11,11,11,11,11,11,12,
     11,10,10,10,10,10,10,11,
     11,10,10,10,10,10,10,11,
@@ -87,95 +92,172 @@ std::array<int, 64> SlidersMagics::_m_bits_rook = {
     12,11,11,11,11,11,11,12,
 };
 
-std::array<std::array<uint64_t, 512>, 64> SlidersMagics::_mbishop_att;
-std::array<std::array<uint64_t, 4096>, 64> SlidersMagics::_mrook_att;
+namespace {
+
+    // rook directions (N, E, S, W) followed by bishop directions (NE, NW, SE, SW)
+    constexpr std::array<int, 8> dir_rank = { 1, 0, -1, 0, 1, 1, -1, -1 },
+                                 dir_file = { 0, 1, 0, -1, 1, -1, 1, -1 };
+
+    // empty board rays for each square and direction
+    constexpr std::array<std::array<uint64_t, 8>, 64> generateRays() {
+        std::array<std::array<uint64_t, 8>, 64> rays = {};
+
+        for (int sq = 0; sq < 64; sq++) {
+            for (int d = 0; d < 8; d++) {
+                for (int r = sq / 8 + dir_rank[d], f = sq % 8 + dir_file[d]; 
+                     0 <= r and r < 8 and 0 <= f and f < 8; r += dir_rank[d], f += dir_file[d])
+                    rays[sq][d] |= 1ULL << (r * 8 + f);
+            }
+        }
+
+        return rays;
+    }
+
+    constexpr auto rays = generateRays();
+
+    // slider attacks computed ray by ray: the part of a ray behind the first blocker is cut off
+    constexpr uint64_t slidingAttacks(int sq, uint64_t occ, bool bishop) {
+        uint64_t att = BitBoard::empty;
+
+        for (int d = bishop ? 4 : 0; d < (bishop ? 8 : 4); d++) {
+            const uint64_t blockers = rays[sq][d] & occ;
+            att |= rays[sq][d];
+
+            if (blockers) {
+                const bool increasing = dir_rank[d] > 0 or (dir_rank[d] == 0 and dir_file[d] > 0);
+                att ^= rays[increasing ? Intrinsics::constBitScanForward64(blockers) : Intrinsics::constBitScanReverse64(blockers)][d];
+            }
+        }
+
+        return att;
+    }
+
+} // namespace
 
 template <Piece::enumType Piece>
-void SlidersMagics::initAttackTables() {
-    static_assert(Piece == Piece::BISHOP or Piece == Piece::ROOK, "Attack tables generated only for bishops or rooks");
+constexpr std::array<unsigned, 64> SlidersMagics::generateOffsets() {
+    std::array<unsigned, 64> offsets = {};
+
+    // bishop entries are placed right after rook ones
+    unsigned offset = Piece == Piece::BISHOP ? _rook_entries : 0;
 
     for (int sq = 0; sq < 64; sq++) {
-        const int relv_bits = Piece == Piece::BISHOP ? _m_bits_bishop[sq] : _m_bits_rook[sq];
-        const uint64_t relv_occ = Piece == Piece::BISHOP ? _m_occupancy_bishop[sq] : _m_occupancy_rook[sq];
-
-        // looping through all occupancy subsets
-        for (int i = 0; i < (1Ui64 << relv_bits); i++) {
-            BitBoard subset = indexToSubset(i, relv_occ, relv_bits);
-
-            if constexpr (Piece == Piece::BISHOP)
-                _mbishop_att[sq][mIndexHash(_magics_bishop[sq], subset, relv_bits)]
-                = generateBishopAttacks(sq, subset);
-            else
-                _mrook_att[sq][mIndexHash(_magics_rook[sq], subset, relv_bits)]
-                = generateRookAttacks(sq, subset);
-        }
+        offsets[sq] = offset;
+        offset += 1 << (Piece == Piece::BISHOP ? _m_bits_bishop[sq] : _m_bits_rook[sq]);
     }
+
+    return offsets;
 }
 
-BitBoard SlidersMagics::indexToSubset(int i, BitBoard relv_occ, int relv_bits) {
-    BitBoard subset = BitBoard::empty;
+constexpr std::array<unsigned, 64> SlidersMagics::_offset_rook = generateOffsets<Piece::ROOK>(),
+                                   SlidersMagics::_offset_bishop = generateOffsets<Piece::BISHOP>();
+
+template <bool Pext>
+constexpr SlidersMagics::AttackTable SlidersMagics::generateAttackTable() {
+    AttackTable table = {};
+
+    for (const bool bishop : { false, true }) {
+        for (int sq = 0; sq < 64; sq++) {
+            const int relv_bits = bishop ? _m_bits_bishop[sq] : _m_bits_rook[sq];
+            const uint64_t relv_occ = bishop ? _m_occupancy_bishop[sq] : _m_occupancy_rook[sq],
+                           magic = bishop ? _magics_bishop[sq] : _magics_rook[sq];
+            const unsigned offset = bishop ? _offset_bishop[sq] : _offset_rook[sq];
 
-    for (int j = 0; j < relv_bits; j++) {
-        const int ls1b_idx = relv_occ.dropForward();
-        if (i & (1Ui64 << j)) subset.setBit(ls1b_idx);
+            // looping through all occupancy subsets with Carry-Rippler trick. Subsets are enumerated
+            // in PEXT order, so i is the PEXT index itself.
+            uint64_t subset = BitBoard::empty;
+
+            for (uint64_t i = 0; i < (1ULL << relv_bits); i++, subset = (subset - relv_occ) & relv_occ) {
+                const uint64_t idx = Pext ? i : (subset * magic) >> (64 - relv_bits);
+                table[offset + idx] = slidingAttacks(sq, subset, bishop);
+            }
+        }
     }
 
-    return subset;
+    return table;
 }
 
-uint64_t SlidersMagics::generateBishopAttacks(Square sq, BitBoard relv_occ) {
-    int f_rank = sq / 8, f_file = sq % 8;
-    uint64_t mask = BitBoard::empty;
+// Generating these tables exceeds default constant evaluation limits of compilers - they have to be
+// raised with /constexpr:steps (MSVC), -fconstexpr-steps (Clang) or -fconstexpr-ops-limit (GCC)
+constexpr SlidersMagics::AttackTable SlidersMagics::_attacks_magic = generateAttackTable<false>();
+#if defined(PEXT_AVAILABLE)
+constexpr SlidersMagics::AttackTable SlidersMagics::_attacks_pext = generateAttackTable<true>();
+#endif
 
-    for (int r = f_rank + 1, f = f_file + 1; r < 8 and f < 8; r++, f++) {
-        mask |= BitBoard(Square(r * 8 + f));
-        if (relv_occ.getBit(r * 8 + f)) break;
-    }
+bool SlidersMagics::hasFastPext() {
+#if defined(PEXT_AVAILABLE)
+    std::array<int, 4> regs;
 
-    for (int r = f_rank - 1, f = f_file + 1; r >= 0 and f < 8; r--, f++) {
-        mask |= BitBoard(Square(r * 8 + f));
-        if (relv_occ.getBit(r * 8 + f)) break;
-    }
-    
-    for (int r = f_rank - 1, f = f_file - 1; r >= 0 and f >= 0; r--, f--) {
-        mask |= BitBoard(Square(r * 8 + f));
-        if (relv_occ.getBit(r * 8 + f)) break;
-    }
-    
-    for (int r = f_rank + 1, f = f_file - 1; r < 8 and f >= 0; r++, f--) {
-        mask |= BitBoard(Square(r * 8 + f));
-        if (relv_occ.getBit(r * 8 + f)) break;
-    }
+    if (!Intrinsics::cpuid(regs, 0))
+        return false;
+
+    // vendor string is stored in EBX, EDX, ECX
+    const bool amd = regs[1] == 0x68747541 and regs[3] == 0x69746e65 and regs[2] == 0x444d4163;
+
+    Intrinsics::cpuid(regs, 1);
 
-    return mask;
+    const int base_family = (regs[0] >> 8) & 0xf,
+              family = base_family == 0xf ? base_family + ((regs[0] >> 20) & 0xff) : base_family;
+
+    if (!Intrinsics::cpuid(regs, 7, 0))
+        return false;
+
+    const bool bmi2 = regs[1] & (1 << 8);
+
+    // Zen 1 and Zen 2 (family 17h) and older AMD cores run PEXT in microcode
+    return bmi2 and !(amd and family < 0x19);
+#else
+    return false;
+#endif
 }
 
-uint64_t SlidersMagics::generateRookAttacks(Square sq, BitBoard relv_occ) {
-    int f_rank = sq / 8, f_file = sq % 8;
-    uint64_t mask = BitBoard::empty;
+void SlidersMagics::benchmark(size_t pressure_mb) {
+    static constexpr size_t lookups = 1 << 25, samples_cnt = 1 << 12;
 
-    for (int r = f_rank + 1; r < 8; r++) {
-        mask |= BitBoard(Square(r * 8 + f_file));
-        if (relv_occ.getBit(r * 8 + f_file)) break;
-    }
+    struct Sample {
+        Square sq;
+        BitBoard occ;
+    };
 
-    for (int r = f_rank - 1; r >= 0; r--) {
-        mask |= BitBoard(Square(r * 8 + f_file));
-        if (relv_occ.getBit(r * 8 + f_file)) break;
-    }
+    std::mt19937_64 engine(0x1eaf);
+    std::vector<Sample> samples(samples_cnt);
 
-    for (int f = f_file + 1; f < 8; f++) {
-        mask |= BitBoard(Square(f_rank * 8 + f));
-        if (relv_occ.getBit(f_rank * 8 + f)) break;
-    }
+    // about 16 random pieces on the board
+    for (auto& sample : samples)
+        sample = Sample{ Square(static_cast<int>(engine() % 64)), engine() & engine() };
+
+    std::vector<uint64_t> pressure(std::max<size_t>(pressure_mb * 1024 * 1024 / sizeof(uint64_t), 1));
+
+    const bool selected = _use_pext;
+
+    for (const bool pext : { false, true }) {
+        if (pext and !hasFastPext())
+            continue;
+
+        _use_pext = pext;
+
+        uint64_t sink = 0, rand = 0;
+        Timer timer;
+        timer.go();
 
-    for (int f = f_file - 1; f >= 0; f--) {
-        mask |= BitBoard(Square(f_rank * 8 + f));
-        if (relv_occ.getBit(f_rank * 8 + f)) break;
+        for (size_t i = 0; i < lookups; i++) {
+            const Sample& sample = samples[i & (samples_cnt - 1)];
+            sink += rookAttacks(sample.sq, sample.occ) ^ bishopAttacks(sample.sq, sample.occ);
+
+            if (pressure_mb) {
+                rand = rand * 6364136223846793005ULL + 1442695040888963407ULL;
+                pressure[(rand >> 24) % pressure.size()] += sink;
+            }
+        }
+
+        timer.stop();
+        const auto duration_ms = std::max<decltype(timer.duration())>(timer.duration(), 1);
+
+        std::cout << (pext ? "pext" : "magic") << ": " << lookups << " lookups in " << duration_ms 
+            << " ms, " << lookups / 1000 / duration_ms << " Mlookups/s, "
+            << "pressure " << pressure_mb << "MB (checksum " << (sink & 0xffff) << ")\n";
     }
 
-    return mask;
+    // restore the backend selected at startup
+    _use_pext = selected;
 }
-
-template void SlidersMagics::initAttackTables<Piece::BISHOP>();
-template void SlidersMagics::initAttackTables<Piece::ROOK>();
\ No newline at end of file
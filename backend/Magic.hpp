@@ -3,10 +3,17 @@
 #include "Common.hpp"
 #include "BitBoard.hpp"
 #include "Piece.hpp"
+#include "Intrinsics.hpp"
 
 // class containing magic bitboards for bishops and rooks,
 // encapsulating hashing function for sliding pieces.
-// Resources need to be initializated by calling initAttackTables function.
+//
+// Two indexing backends are available: BMI2 PEXT instruction and fancy magic multiplication
+// as a fallback. Both of them use the same compact table layout, where every square owns only
+// 2 ^ (relevant bits) entries. Tables of both backends are generated at compile time into
+// read-only data, so only CPUID check is left for the startup - the backend is chosen once,
+// so both branches of the attack getters are then perfectly predicted. PEXT is compiled into
+// every x86-64 build, so a build for CPUs without BMI2 still uses it where it's available.
 class SlidersMagics {
 public:
     static INLINE constexpr int mIndexHash(BitBoard magic_bb, BitBoard relv_occ, int relv_bits) {
@@ -14,39 +21,77 @@ public:
     }
 
     static INLINE BitBoard bishopAttacks(Square sq, BitBoard occ) {
-        return _mbishop_att[sq][mIndexHash(_magics_bishop[sq], _m_occupancy_bishop[sq] & occ, _m_bits_bishop[sq])];
+#if defined(PEXT_AVAILABLE)
+        if (_use_pext)
+            return bishopAttacksPext(sq, occ);
+#endif
+
+        return _attacks_magic[_offset_bishop[sq] + mIndexHash(_magics_bishop[sq], _m_occupancy_bishop[sq] & occ, _m_bits_bishop[sq])];
     }
 
     static INLINE BitBoard rookAttacks(Square sq, BitBoard occ) {
-        return _mrook_att[sq][mIndexHash(_magics_rook[sq], _m_occupancy_rook[sq] & occ, _m_bits_rook[sq])];
+#if defined(PEXT_AVAILABLE)
+        if (_use_pext)
+            return rookAttacksPext(sq, occ);
+#endif
+
+        return _attacks_magic[_offset_rook[sq] + mIndexHash(_magics_rook[sq], _m_occupancy_rook[sq] & occ, _m_bits_rook[sq])];
     }
 
     static INLINE BitBoard queenAttacks(Square sq, BitBoard occ) {
         return rookAttacks(sq, occ) | bishopAttacks(sq, occ);
     }
 
-    // initialize look-up tables for bishop and rook
-    template <Piece::enumType Piece>
-    static void initAttackTables();
+    static INLINE bool usesPext() { return _use_pext; }
+
+    // measure speed of attack look-ups of both backends. Every look-up is paired with a random
+    // access to a buffer of given size, imitating transposition table probes competing for cache.
+    static void benchmark(size_t pressure_mb);
 private:
-    static BitBoard indexToSubset(int i, BitBoard relv_occ, int relv_bits);
+    // shared look-up table of rook and bishop attacks (~841KB instead of 2.25MB of plain magics).
+    // Each square occupies exactly 2 ^ (relevant bits) entries, starting at its offset:
+    // 102400 entries for rooks, followed by 5248 entries for bishops.
+    static constexpr size_t _rook_entries = 102400, _bishop_entries = 5248;
+
+    using AttackTable = std::array<uint64_t, _rook_entries + _bishop_entries>;
+
+    template <Piece::enumType Piece>
+    static constexpr std::array<unsigned, 64> generateOffsets();
 
-    static uint64_t generateBishopAttacks(Square sq, BitBoard relv_occ);
-    static uint64_t generateRookAttacks(Square sq, BitBoard relv_occ);
+    template <bool Pext>
+    static constexpr AttackTable generateAttackTable();
+
+#if defined(PEXT_AVAILABLE)
+    // built for BMI2 even when the rest of the binary isn't, so called only when _use_pext is set
+    static PEXT_FUNCTION uint64_t bishopAttacksPext(Square sq, uint64_t occ) {
+        return _attacks_pext[_offset_bishop[sq] + Intrinsics::pext64(occ, _m_occupancy_bishop[sq])];
+    }
+
+    static PEXT_FUNCTION uint64_t rookAttacksPext(Square sq, uint64_t occ) {
+        return _attacks_pext[_offset_rook[sq] + Intrinsics::pext64(occ, _m_occupancy_rook[sq])];
+    }
+#endif
+
+    // true when the CPU supports BMI2 and executes PEXT natively
+    // (AMD before Zen 3 implements it in slow microcode)
+    static bool hasFastPext();
 
     // magic bitboards for bishop and rook
-	static std::array<uint64_t, 64> _magics_bishop, _magics_rook;
+	static const std::array<uint64_t, 64> _magics_bishop, _magics_rook;
+
+    // attack tables in fancy magic and PEXT order
+    static const AttackTable _attacks_magic;
+#if defined(PEXT_AVAILABLE)
+    static const AttackTable _attacks_pext;
+#endif
+    static const std::array<unsigned, 64> _offset_bishop, _offset_rook;
 
-    // look-up tables of rook and bishop attacks in Plain Magic Bitboards implementation
-    // 4096 = 2 ^ 12 - maximum number of occupancy subsets for rook (rook at [a1, h8])
-    // 512 = 2 ^ 9 - maximum number of occupancy subsets for bishop (bishop at board center [d4, d5, e4, e5])
-    static std::array<std::array<uint64_t, 4096>, 64> _mrook_att;
-    static std::array<std::array<uint64_t, 512>, 64> _mbishop_att;
+    static inline bool _use_pext = hasFastPext();
 
     // relevant occupancy pre-computed masks
-    static std::array<uint64_t, 64> _m_occupancy_bishop, _m_occupancy_rook;
+    static const std::array<uint64_t, 64> _m_occupancy_bishop, _m_occupancy_rook;
 
     // relevant occupancy bits count for bishop and rook - later used in hash function
     // while shifting product number
-    static std::array<int, 64> _m_bits_bishop, _m_bits_rook;
+    static const std::array<int, 64> _m_bits_bishop, _m_bits_rook;
 };
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "MappedFile.hpp"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile() {
+	close();
+}
+
+bool MappedFile::open(const std::string& path) {
+	close();
+
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, 
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER file_size;
+	HANDLE mapping = GetFileSizeEx(file, &file_size) and file_size.QuadPart ?
+		CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+
+	CloseHandle(file);
+
+	if (!mapping)
+		return false;
+
+	// the view keeps the mapping alive
+	const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+
+	if (!data)
+		return false;
+
+	_size = static_cast<size_t>(file_size.QuadPart);
+#else
+	const int fd = ::open(path.c_str(), O_RDONLY);
+
+	if (fd < 0)
+		return false;
+
+	struct stat file_stat;
+
+	if (fstat(fd, &file_stat) or !file_stat.st_size) {
+		::close(fd);
+		return false;
+	}
+
+	// the mapping stays valid after closing the descriptor
+	void* data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+
+	if (data == MAP_FAILED)
+		return false;
+
+	_size = static_cast<size_t>(file_stat.st_size);
+#endif
+
+	_data = static_cast<const uint8_t*>(data);
+	return true;
+}
+
+void MappedFile::close() {
+	if (!_data)
+		return;
+
+#if defined(_WIN32)
+	UnmapViewOfFile(_data);
+#else
+	munmap(const_cast<uint8_t*>(_data), _size);
+#endif
+
+	_data = nullptr;
+	_size = 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Common.hpp"
+
+// read-only memory mapping of a whole file, shared by book probing and PGN reading
+class MappedFile {
+public:
+	MappedFile() = default;
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	// returns false when the file can't be mapped, e.g. it doesn't exist or it's empty
+	bool open(const std::string& path);
+	void close();
+
+	INLINE bool isOpen() const { return _data != nullptr; }
+	INLINE const uint8_t* data() const { return _data; }
+	INLINE size_t size() const { return _size; }
+
+	INLINE std::string_view view() const {
+		return std::string_view(reinterpret_cast<const char*>(_data), _size);
+	}
+private:
+	const uint8_t* _data = nullptr;
+	size_t _size = 0;
+};
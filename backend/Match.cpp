@@ -0,0 +1,273 @@
+#include "Match.hpp"
+#include "Epd.hpp"
+#include "Fen.hpp"
+#include "MappedFile.hpp"
+#include "MoveGen.hpp"
+#include "Search.hpp"
+#include "TranspositionTable.hpp"
+
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+	INLINE double scoreFromElo(double elo) {
+		return 1 / (1 + std::pow(10, -elo / 400));
+	}
+
+	INLINE double eloFromScore(double score) {
+		// no Elo of a perfect score, it's kept finite
+		score = std::clamp(score, 1e-6, 1 - 1e-6);
+		return 400 * std::log10(score / (1 - score));
+	}
+
+} // namespace
+
+double MatchStats::elo() const {
+	return games() ? eloFromScore((wins + draws / 2.0) / games()) : 0;
+}
+
+double MatchStats::eloMargin() const {
+	const double n = static_cast<double>(games());
+
+	if (!n)
+		return 0;
+
+	const double score = (wins + draws / 2.0) / n,
+				 variance = (wins * (1 - score) * (1 - score) + draws * (0.5 - score) * (0.5 - score)
+					 + losses * score * score) / n,
+				 error = 1.96 * std::sqrt(variance / n);
+
+	return std::max((eloFromScore(score + error) - eloFromScore(score - error)) / 2, 0.0);
+}
+
+std::string MatchStats::toStr(double elo0, double elo1) const {
+	char str[160];
+
+	std::snprintf(str, sizeof(str), "score +%llu -%llu =%llu, elo %.2f +- %.2f, llr %.2f",
+		static_cast<unsigned long long>(wins), static_cast<unsigned long long>(losses),
+		static_cast<unsigned long long>(draws), elo(), eloMargin(), llr(elo0, elo1));
+
+	return str;
+}
+
+/*
+	Generalized SPRT approximation: with score s and its variance per game, the log-likelihood
+	ratio of expected scores s1 and s0 of both hypotheses is n * (s1 - s0) * (2s - s0 - s1) / (2 * variance).
+*/
+double MatchStats::llr(double elo0, double elo1) const {
+	const double n = static_cast<double>(games());
+
+	if (!n)
+		return 0;
+
+	const double score = (wins + draws / 2.0) / n,
+				 variance = (wins * (1 - score) * (1 - score) + draws * (0.5 - score) * (0.5 - score)
+					 + losses * score * score) / n;
+
+	if (variance <= 0)
+		return 0;
+
+	const double s0 = scoreFromElo(elo0),
+				 s1 = scoreFromElo(elo1);
+
+	return n * (s1 - s0) * (2 * score - s0 - s1) / (2 * variance);
+}
+
+struct Match::Player {
+	Player(const Side& side)
+		: name(side.name) {
+		tt.resize(std::bit_floor(std::max<size_t>(side.hash_mb, 1)));
+		tt.reset();
+
+		search = std::make_unique<Search>(tt);
+		search->setPrintInfo(false);
+		search->setTablebaseProbeDepth(side.tb_probe_depth);
+		search->getEval().getCache().resize(side.eval_cache_mb);
+	}
+
+	std::string name;
+	TranspositionTable tt;
+	std::unique_ptr<Search> search;
+};
+
+bool Match::run(const Settings& settings) {
+	_stats = MatchStats();
+
+	// empty FEN stands for the starting position
+	std::vector<std::string> openings;
+
+	if (settings.openings.empty())
+		openings.emplace_back();
+	else {
+		MappedFile file;
+
+		if (!file.open(settings.openings))
+			return false;
+
+		EpdRecord record;
+		Position pos;
+
+		// positions which can't be played are left out
+		for (const auto line : Epd::splitLines(file.view())) {
+			if (Epd::parse(line, record, pos))
+				openings.push_back(Fen::toStr(pos));
+		}
+
+		if (openings.empty())
+			return false;
+	}
+
+	const unsigned games = (settings.games + 1) / 2 * 2;
+	const double lower_bound = std::log(settings.beta / (1 - settings.alpha)),
+				 upper_bound = std::log((1 - settings.beta) / settings.alpha);
+
+	char bounds[128];
+	std::snprintf(bounds, sizeof(bounds), "info string SPRT elo0 %.2f elo1 %.2f, llr bounds %.2f %.2f\n",
+		settings.elo0, settings.elo1, lower_bound, upper_bound);
+	std::cout << bounds;
+
+	std::atomic<unsigned> next_game = 0;
+	std::atomic<bool> stop = false;
+	std::mutex mutex;
+
+	auto work = [&] {
+		Player first(settings.sides[0]),
+			   second(settings.sides[1]);
+
+		for (unsigned idx; !stop and (idx = next_game++) < games; ) {
+			// the first side is white in even games, the opening is the same within a pair
+			const bool first_white = idx % 2 == 0;
+			const std::array<Player*, 2> players = first_white ? std::array{ &first, &second } : std::array{ &second, &first };
+
+			std::string reason;
+			const PgnGame::enumResult result = play(players, openings[idx / 2 % openings.size()], settings, stop, reason);
+
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (result == PgnGame::UNKNOWN or stop)
+				break;
+
+			if (result == PgnGame::DRAW)
+				_stats.draws++;
+			else if ((result == PgnGame::WHITE_WIN) == first_white)
+				_stats.wins++;
+			else
+				_stats.losses++;
+
+			const double llr = _stats.llr(settings.elo0, settings.elo1);
+
+			std::cout << "info string game " << _stats.games() << ' ' << players[WHITE]->name << " - " << players[BLACK]->name
+				<< ' ' << (result == PgnGame::DRAW ? "1/2-1/2" : result == PgnGame::WHITE_WIN ? "1-0" : "0-1")
+				<< " (" << reason << "), " << _stats.toStr(settings.elo0, settings.elo1) << '\n';
+
+			if (llr <= lower_bound or upper_bound <= llr) {
+				std::cout << "info string SPRT accepts " << (llr <= lower_bound ? "H0" : "H1") << '\n';
+				stop = true;
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+
+	for (unsigned i = 0; i < std::max(settings.concurrency, 1U); i++)
+		workers.emplace_back(work);
+
+	for (auto& worker : workers)
+		worker.join();
+
+	return true;
+}
+
+PgnGame::enumResult Match::play(const std::array<Player*, 2>& players, const std::string& fen, const Settings& settings,
+	const std::atomic<bool>& abort, std::string& reason) const {
+	Position pos;
+	Game game;
+
+	if (fen.empty())
+		pos.setStartingPos();
+	else
+		pos.setByFEN(fen);
+
+	// nothing carries over from the previous game
+	for (Player* player : players) {
+		player->tt.reset();
+		player->search->clearCounterMoves();
+	}
+
+	std::array<int64_t, 2> clock = { settings.base_ms, settings.base_ms };
+
+	// plies in a row scored within the draw score
+	unsigned quiet_plies = 0;
+
+	for (unsigned ply = 0; !abort; ply++) {
+		const enumColor turn = pos.getTurn();
+
+		MoveList legal_moves;
+		MoveGen::generateLegalMoves(pos, legal_moves);
+
+		if (!legal_moves.count()) {
+			const bool mate = pos.isInCheck(turn);
+
+			reason = mate ? "mate" : "stalemate";
+			return !mate ? PgnGame::DRAW : turn == WHITE ? PgnGame::BLACK_WIN : PgnGame::WHITE_WIN;
+		}
+
+		const char* draw = pos.halfmoveClock() >= 100 ? "50-move rule"
+						 : pos.isInsufficientMaterial() ? "insufficient material"
+						 : game.isThreefold(pos.getZobristKey(), pos.halfmoveClock()) ? "threefold repetition"
+						 : game.currentHalfCount() + 1 >= max_game_moves ? "game length" : nullptr;
+
+		if (draw) {
+			reason = draw;
+			return PgnGame::DRAW;
+		}
+
+		SearchLimits limits;
+		limits.depth = max_depth - 1;
+
+		if (settings.nodes)
+			limits.nodes = settings.nodes;
+		else {
+			limits.wtime = static_cast<unsigned>(std::max<int64_t>(clock[WHITE], 1));
+			limits.btime = static_cast<unsigned>(std::max<int64_t>(clock[BLACK], 1));
+			limits.winc = limits.binc = settings.inc_ms;
+		}
+
+		Search& search = *players[turn]->search;
+		Timer timer;
+
+		timer.go();
+		search.bestMove(pos, game, limits);
+		timer.stop();
+
+		if (!settings.nodes) {
+			clock[turn] -= timer.duration();
+
+			if (clock[turn] < 0) {
+				reason = "time forfeit";
+				return turn == WHITE ? PgnGame::BLACK_WIN : PgnGame::WHITE_WIN;
+			}
+
+			clock[turn] += settings.inc_ms;
+		}
+
+		const SearchResults& results = search.getResults();
+		Move move = results.best_move;
+		Position::IrreversibleState state;
+
+		quiet_plies = std::abs(results.score_cp.toInt()) <= settings.draw_score ? quiet_plies + 1 : 0;
+
+		game.recordInfo(pos.getZobristKey(), move);
+		pos.make(move, state);
+
+		if (ply / 2 + 1 >= settings.draw_move_number and quiet_plies >= 2 * settings.draw_move_count) {
+			reason = "adjudication";
+			return PgnGame::DRAW;
+		}
+	}
+
+	return PgnGame::UNKNOWN;
+}
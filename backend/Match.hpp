@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Pgn.hpp"
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+// results of a match from the point of view of the first side, with Elo estimate and SPRT
+struct MatchStats {
+	// Elo difference of the score and its 95% confidence margin
+	double elo() const;
+	double eloMargin() const;
+
+	// log-likelihood ratio of the hypotheses elo1 against elo0, trinomial model of game results
+	double llr(double elo0, double elo1) const;
+
+	INLINE uint64_t games() const { return wins + losses + draws; }
+
+	// score, Elo and LLR in one line
+	std::string toStr(double elo0, double elo1) const;
+
+	uint64_t wins   = 0,
+			 losses = 0,
+			 draws  = 0;
+};
+
+/*
+	Engine against engine games played inside one process. Each side of a game has its own Search
+	and hash table, so both sides can be set up differently. Every opening is played twice with
+	colors swapped, several games are played at once. Games end with mate, stalemate, 50-move rule,
+	threefold repetition or insufficient material, a draw is adjudicated like in Tournament.bat:
+	from given move number on, when both sides have scored the position within draw_score
+	for draw_move_count moves in a row. Results are counted as games complete and the match stops
+	as soon as SPRT accepts one of its hypotheses.
+*/
+class Match {
+public:
+	struct Side {
+		std::string name;
+		size_t hash_mb = 16,
+			   eval_cache_mb = 2;
+		unsigned tb_probe_depth = 1;
+	};
+
+	struct Settings {
+		std::array<Side, 2> sides = { Side{ "first" }, Side{ "second" } };
+		// games in total, rounded up to pairs of games
+		unsigned games = 4000,
+				 concurrency = 1;
+		// time control, or fixed nodes per move when nodes are given
+		unsigned base_ms = 1000,
+				 inc_ms = 40;
+		uint64_t nodes = 0;
+		// EPD file of opening positions, starting position when empty
+		std::string openings;
+		unsigned draw_move_number = 36,
+				 draw_move_count = 8;
+		int draw_score = 10;
+		double elo0 = 0, elo1 = 5,
+			   alpha = 0.05, beta = 0.05;
+	};
+
+	// returns false when the openings can't be read
+	bool run(const Settings& settings);
+
+	INLINE const MatchStats& getStats() const { return _stats; }
+private:
+	struct Player;
+
+	// game between the players given by color, the result is unknown when the game has been aborted
+	PgnGame::enumResult play(const std::array<Player*, 2>& players, const std::string& fen, const Settings& settings,
+		const std::atomic<bool>& abort, std::string& reason) const;
+
+	MatchStats _stats;
+};
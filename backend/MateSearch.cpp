@@ -0,0 +1,282 @@
+#include "MateSearch.hpp"
+#include "MoveGen.hpp"
+
+MateSearch::NodeArena::NodeArena(size_t size)
+	: _size(size) {}
+
+void MateSearch::NodeArena::clear() {
+	// memory is reserved lazily, with the first mate search
+	if (_nodes.size() != _size)
+		_nodes.resize(_size);
+
+	_used = 0;
+}
+
+uint32_t MateSearch::NodeArena::allocate(size_t count) {
+	if (_used + count > _size)
+		return null_idx;
+
+	const uint32_t idx = static_cast<uint32_t>(_used);
+	_used += count;
+	return idx;
+}
+
+MateSearch::MateSearch(size_t arena_nodes)
+	: _arena(arena_nodes) {}
+
+void MateSearch::bestMove(Position& pos, SearchLimits limits) {
+	ASSERT(1 <= limits.mate and limits.mate <= max_depth / 2, "Invalid mate length");
+
+	limits.timer.go();
+	limits.search_time = TimeMan::searchTime(pos, limits);
+
+	Timer timer;
+	timer.go();
+
+	_nodes_cnt = 0;
+
+	for (unsigned n = 1; n <= limits.mate; n++) {
+		const enumResult result = solve(pos, limits, 2 * n - 1);
+
+		if (result == enumResult::PROVEN) {
+			timer.stop();
+			printInfo(n, timer);
+			return;
+		}
+		else if (result == enumResult::UNKNOWN)
+			break;
+	}
+
+	timer.stop();
+	std::cout << "info string no mate in " << limits.mate << " found, nodes " << _nodes_cnt
+		<< " time " << timer.duration() << '\n';
+
+	// no proof - send the most promising move of the last tree, if there is any
+	Move best_move = Move::null;
+
+	if (_arena.used() and _arena[0].expanded and _arena[0].child_cnt)
+		best_move = _arena[selectChild(0, true)].move;
+
+	std::cout << "bestmove ";
+	best_move.print();
+	std::cout << '\n';
+}
+
+MateSearch::enumResult MateSearch::solve(Position& pos, SearchLimits& limits, unsigned max_ply) {
+	struct PathEntry {
+		uint32_t idx;
+		Position::IrreversibleState state;
+		Move move;
+	};
+
+	std::array<PathEntry, max_depth> path;
+
+	_arena.clear();
+
+	const uint32_t root = _arena.allocate(1);
+	_arena[root] = PNNode{ 1, 1, NodeArena::null_idx, 0, false, Move::null };
+
+	uint32_t idx = root;
+	unsigned ply = 0;
+	bool out_of_resources = false;
+
+	while (_arena[root].pn and _arena[root].dn) {
+		// select the most-proving node
+		while (_arena[idx].expanded) {
+			path[ply].idx = idx;
+			path[ply].move = _arena[idx = selectChild(idx, ply % 2 == 0)].move;
+			pos.make(path[ply].move, path[ply].state);
+			ply++;
+		}
+
+		if ((_nodes_cnt & _check_node_count) == 0 and !limits.isTimeLeft()) {
+			out_of_resources = true;
+			break;
+		}
+
+		uint32_t old_pn = _arena[idx].pn,
+				 old_dn = _arena[idx].dn;
+
+		if (!expand(pos, idx, ply, max_ply)) {
+			out_of_resources = true;
+			break;
+		}
+
+		// back up new numbers, as long as they change
+		for (;;) {
+			updateNumbers(idx, ply % 2 == 0);
+
+			if ((_arena[idx].pn == old_pn and _arena[idx].dn == old_dn) or ply == 0)
+				break;
+
+			ply--;
+			pos.unmake(path[ply].move, path[ply].state);
+			idx = path[ply].idx;
+
+			old_pn = _arena[idx].pn;
+			old_dn = _arena[idx].dn;
+		}
+	}
+
+	while (ply) {
+		ply--;
+		pos.unmake(path[ply].move, path[ply].state);
+	}
+
+	if (out_of_resources)
+		return enumResult::UNKNOWN;
+
+	return _arena[root].pn == 0 ? enumResult::PROVEN : enumResult::DISPROVEN;
+}
+
+bool MateSearch::expand(Position& pos, uint32_t idx, unsigned ply, unsigned max_ply) {
+	std::array<PNNode, max_node_moves> children;
+	uint16_t child_cnt = 0;
+
+	MoveList move_list;
+	MoveGen::generatePseudoLegalMoves<MoveGen::ALL>(pos, move_list);
+
+	Position::IrreversibleState state;
+	const bool child_or_node = ply % 2 == 1;
+
+	for (size_t i = 0; i < move_list.count(); i++) {
+		Move move = move_list.getMove(i);
+
+		if (!pos.make(move, state)) {
+			pos.unmake(move, state);
+			continue;
+		}
+
+		const bool check = pos.isInCheck(pos.getTurn());
+
+		// attacker's last move has to be a check, otherwise it can't be a mate
+		if (child_or_node or ply + 1 != max_ply or check) {
+			PNNode& child = children[child_cnt++];
+			const unsigned moves_cnt = legalMovesCount(pos);
+
+			child = PNNode{ 1, 1, NodeArena::null_idx, 0, false, move };
+			_nodes_cnt++;
+
+			if (!moves_cnt) {
+				// checkmate is a win only when the defender is mated, stalemate is never a win
+				const bool proven = check and !child_or_node;
+				child.pn = proven ? 0 : _infinity;
+				child.dn = proven ? _infinity : 0;
+			}
+			else if (!child_or_node and ply + 1 == max_ply) {
+				child.pn = _infinity;
+				child.dn = 0;
+			}
+			// mobility initialization: few replies of the defender makes proof easier,
+			// few moves of the attacker makes disproof easier
+			else if (child_or_node)
+				child.dn = moves_cnt;
+			else
+				child.pn = moves_cnt;
+		}
+
+		pos.unmake(move, state);
+	}
+
+	const uint32_t first = _arena.allocate(child_cnt);
+
+	if (first == NodeArena::null_idx)
+		return false;
+
+	for (uint16_t i = 0; i < child_cnt; i++)
+		_arena[first + i] = children[i];
+
+	_arena[idx].first_child = first;
+	_arena[idx].child_cnt = child_cnt;
+	_arena[idx].expanded = true;
+
+	return true;
+}
+
+void MateSearch::updateNumbers(uint32_t idx, bool or_node) {
+	PNNode& node = _arena[idx];
+
+	uint32_t min = _infinity, sum = 0;
+
+	for (uint32_t i = node.first_child; i < node.first_child + node.child_cnt; i++) {
+		const PNNode& child = _arena[i];
+		min = std::min(min, or_node ? child.pn : child.dn);
+		sum = saturatedAdd(sum, or_node ? child.dn : child.pn);
+	}
+
+	// OR node: proof of single child is enough, disproof needs all of them. AND node vice versa.
+	node.pn = or_node ? min : sum;
+	node.dn = or_node ? sum : min;
+}
+
+uint32_t MateSearch::selectChild(uint32_t idx, bool or_node) {
+	const PNNode& node = _arena[idx];
+
+	assert(node.expanded and node.child_cnt);
+
+	uint32_t best = node.first_child;
+
+	for (uint32_t i = node.first_child + 1; i < node.first_child + node.child_cnt; i++) {
+		if (or_node ? _arena[i].pn < _arena[best].pn : _arena[i].dn < _arena[best].dn)
+			best = i;
+	}
+
+	return best;
+}
+
+unsigned MateSearch::legalMovesCount(Position& pos) {
+	MoveList move_list;
+	MoveGen::generatePseudoLegalMoves<MoveGen::ALL>(pos, move_list);
+
+	Position::IrreversibleState state;
+	unsigned cnt = 0;
+
+	for (size_t i = 0; i < move_list.count(); i++) {
+		Move move = move_list.getMove(i);
+		cnt += pos.make(move, state);
+		pos.unmake(move, state);
+	}
+
+	return cnt;
+}
+
+void MateSearch::printInfo(unsigned mate_len, Timer& timer) {
+	const auto duration_ms = timer.duration();
+	const uint64_t nps = static_cast<uint64_t>((_nodes_cnt * 1000.f) / (duration_ms ? duration_ms : 1));
+
+	std::cout << "info depth " << 2 * mate_len - 1
+		<< " score mate " << mate_len
+		<< " nodes " << _nodes_cnt
+		<< " time " << duration_ms
+		<< " nps " << nps
+		<< " pv ";
+
+	// follow the proof tree: any proven move of the attacker and a defence 
+	// which doesn't get mated immediately, if there is such
+	Move best_move = Move::null;
+	uint32_t idx = 0;
+
+	for (unsigned ply = 0; _arena[idx].expanded and _arena[idx].child_cnt; ply++) {
+		const PNNode& node = _arena[idx];
+		uint32_t next = node.first_child;
+
+		for (uint32_t i = node.first_child; i < node.first_child + node.child_cnt; i++) {
+			if (ply % 2 == 0 ? _arena[i].pn == 0 : _arena[i].expanded) {
+				next = i;
+				break;
+			}
+		}
+
+		const Move move = _arena[next].move;
+
+		if (ply == 0)
+			best_move = move;
+
+		move.print(), std::cout << ' ';
+		idx = next;
+	}
+
+	std::cout << "\nbestmove ";
+	best_move.print();
+	std::cout << '\n';
+}
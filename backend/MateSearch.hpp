@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Position.hpp"
+#include "Move.hpp"
+#include "Search.hpp"
+
+#include <vector>
+
+/*
+	Proof-number search for 'go mate N' problems.
+
+	The tree is stored explicitly in a node arena, allocated once and reused by all the
+	searches - no per-node heap allocations happen while solving. Nodes with the attacker
+	to move are OR nodes, nodes with the defender to move are AND nodes. Children of a node
+	occupy a contiguous block of the arena, so the tree needs no parent pointers -
+	path from the root to the current node is kept on a stack instead.
+
+	Mate lengths are tried from 1 to N, so the first proven length is the shortest mate.
+*/
+
+class MateSearch {
+public:
+	MateSearch(size_t arena_nodes = _default_arena_nodes);
+
+	void bestMove(Position& pos, SearchLimits limits);
+private:
+	struct PNNode {
+		uint32_t pn, dn;
+		uint32_t first_child;
+		uint16_t child_cnt;
+		bool expanded;
+		Move move;
+	};
+
+	// bump allocator of tree nodes, freed all at once before every search
+	class NodeArena {
+	public:
+		NodeArena(size_t size);
+
+		// returns null_idx if there is no room left
+		uint32_t allocate(size_t count);
+
+		INLINE PNNode& operator[](uint32_t idx) {
+			assert(idx < _used);
+			return _nodes[idx];
+		}
+
+		INLINE size_t used() const { return _used; }
+		void clear();
+
+		static constexpr uint32_t null_idx = std::numeric_limits<uint32_t>::max();
+	private:
+		std::vector<PNNode> _nodes;
+		size_t _size, _used = 0;
+	};
+
+	enum class enumResult : uint8_t {
+		PROVEN,
+		DISPROVEN,
+		UNKNOWN,
+	};
+
+	enumResult solve(Position& pos, SearchLimits& limits, unsigned max_ply);
+	bool expand(Position& pos, uint32_t idx, unsigned ply, unsigned max_ply);
+	void updateNumbers(uint32_t idx, bool or_node);
+	uint32_t selectChild(uint32_t idx, bool or_node);
+
+	unsigned legalMovesCount(Position& pos);
+	void printInfo(unsigned mate_len, Timer& timer);
+
+	INLINE static uint32_t saturatedAdd(uint32_t a, uint32_t b) {
+		return std::min(a + b, _infinity);
+	}
+
+	NodeArena _arena;
+	uint64_t _nodes_cnt = 0;
+
+	static constexpr size_t _default_arena_nodes = 1 << 22;
+	static constexpr uint32_t _infinity = std::numeric_limits<uint32_t>::max() / 2;
+	static constexpr uint64_t _check_node_count = 4096;
+};
@@ -0,0 +1,11 @@
+#include "MaterialTable.hpp"
+
+// entries start with zero key, which never matches - kings are always counted in the material key
+MaterialTable::MaterialTable()
+	: _mem(std::make_unique<MaterialEntry[]>(_size)) {
+	static_assert(sizeof(MaterialEntry) == 32);
+}
+
+void MaterialTable::clear() {
+	std::fill(&_mem[0], &_mem[_size], MaterialEntry{});
+}
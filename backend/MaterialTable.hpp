@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Endgame.hpp"
+#include "Intrinsics.hpp"
+
+#include <memory>
+
+// evaluation data depending only on piece counts of both sides
+struct alignas(32) MaterialEntry {
+	uint64_t key;
+	// imbalance terms, from white point of view - piece values are a part of piece-square tables
+	PackedScore score;
+	// weight of middlegame score, 0 for bare kings up to PackedScore::max_phase with all the pieces on board
+	uint8_t phase;
+	// eval of a side leading in score is multiplied by scale / 64, so drawish configurations are scored closer to 0
+	std::array<uint8_t, 2> scale;
+	// both sides have just one bishop and pawns - drawish with bishops of opposite colors
+	bool bishops_only;
+	enumColor strong;
+	// specialised evaluation of the strong side, nullptr if there is none
+	Endgame::EvalFunc endgame;
+};
+
+/*
+	Material configuration rarely changes in the search, so the table hit rate is close to 100%.
+	Entries are indexed by the material key of a position, maintained incrementally in make/unmake.
+	Always-replace scheme, the table is owned by a single search thread.
+*/
+class MaterialTable {
+public:
+	MaterialTable();
+
+	// returns slot of given key, holding another material configuration when key doesn't match
+	MaterialEntry* probe(uint64_t key);
+	void clear();
+
+	static constexpr uint8_t scale_normal = 64;
+private:
+	static constexpr size_t _size = 8192;
+
+	std::unique_ptr<MaterialEntry[]> _mem;
+};
+
+INLINE MaterialEntry* MaterialTable::probe(uint64_t key) {
+	return &_mem[key & (_size - 1)];
+}
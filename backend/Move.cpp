@@ -52,6 +52,18 @@ void Move::print() const {
 #endif
 }
 
+std::string Move::toStr() const {
+	if (_rmove == null)
+		return static_cast<std::string>(_null_str);
+
+	std::string str = getOrigin().toStr() + getTarget().toStr();
+
+	if (isPromotion())
+		str += "pnbrqk"[getPromoPieceT()];
+
+	return str;
+}
+
 bool Move::isPseudoLegal(const Position& pos) const {
 	const Square org = getOrigin(), dst = getTarget();
 	const Piece::enumType p = getPerformerT(), d = pos.pieceTypeOn(dst, pos.getOppositeTurn());
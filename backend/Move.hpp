@@ -113,6 +113,7 @@ public:
 	}
 
 	void print() const;
+	std::string toStr() const;
 
 	bool isPseudoLegal(const Position& pos) const;
 
@@ -123,7 +124,7 @@ public:
 		SHORT, LONG
 	};
 
-	static constexpr uint32_t null = 0Ui32;
+	static constexpr uint32_t null = 0U;
 private:
 	static constexpr std::string_view _null_str = "0000";
 
@@ -248,4 +248,19 @@ void MoveGen::generatePseudoLegalMoves<MoveGen::ALL>(const Position& pos, MoveLi
 
 template void MoveGen::generatePseudoLegalMoves<MoveGen::CAPTURES>(const Position&, MoveList&);
 template void MoveGen::generatePseudoLegalMoves<MoveGen::TACTICALS>(const Position&, MoveList&);
-template void MoveGen::generatePseudoLegalMoves<MoveGen::QUIETS>(const Position&, MoveList&);
\ No newline at end of file
+template void MoveGen::generatePseudoLegalMoves<MoveGen::QUIETS>(const Position&, MoveList&);
+
+void MoveGen::generateLegalMoves(Position& pos, MoveList& move_list) {
+	MoveList pseudo_legal;
+	generatePseudoLegalMoves<ALL>(pos, pseudo_legal);
+
+	for (size_t i = 0; i < pseudo_legal.count(); i++) {
+		Move move = pseudo_legal.getMove(i);
+		Position::IrreversibleState state;
+
+		if (pos.make(move, state))
+			move_list.push(Move(move));
+
+		pos.unmake(move, state);
+	}
+}
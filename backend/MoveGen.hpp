@@ -23,4 +23,7 @@ public:
 
 	template <enumMode GenType>
 	static void generatePseudoLegalMoves(const Position& pos, MoveList& move_list);
+
+	// all legal moves, checked by making them
+	static void generateLegalMoves(Position& pos, MoveList& move_list);
 };
\ No newline at end of file
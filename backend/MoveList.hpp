@@ -17,6 +17,12 @@ public:
 			_greater_score);
 	}
 
+	// stable move of all the moves from given origin square to the front of [first, end) range
+	INLINE void prioritizeOrigin(size_t first, Square origin) {
+		std::stable_partition(_moves.data() + first, _moves.data() + _idx, 
+			[origin](Entry e) { return e.move.getOrigin() == origin; });
+	}
+
 	INLINE void push(Move&& new_move) {
 		assert(_idx < _size);
 		_moves[_idx++].move = new_move;
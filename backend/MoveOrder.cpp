@@ -2,6 +2,7 @@
 #include "Position.hpp"
 #include "Search.hpp"
 
+template <>
 void MoveOrder<PLAIN>::generateMoves(const Position& pos) {
 	_iterator = 0;
 	_move_list.clear();
@@ -9,6 +10,7 @@ void MoveOrder<PLAIN>::generateMoves(const Position& pos) {
 	MoveGen::generatePseudoLegalMoves<MoveGen::QUIETS>(pos, _move_list);
 }
 
+template <>
 bool MoveOrder<PLAIN>::nextMove(const TreeInfo&, const NodeInfo&, const Position&, Move& next_move) {
 	return getFromList(next_move);
 }
@@ -65,7 +67,7 @@ bool MoveOrder<Type>::nextMove(const TreeInfo& tree, const NodeInfo& node, const
 
 		if (node.ply > 0) {
 			const Move prev = tree.getNode(node.ply - 1).move;
-			_counter = _countermove[pos.getOppositeTurn()][prev.getPerformerT()][prev.getTarget()];
+			_counter = tree.getCounterMove(pos.getOppositeTurn(), prev);
 
 			if (!_counter.isNull() and _counter != _hash_move
 				and _counter != _killer_move and _counter.isPseudoLegal(pos)) {
@@ -75,9 +77,15 @@ bool MoveOrder<Type>::nextMove(const TreeInfo& tree, const NodeInfo& node, const
 		}
 
 		[[fallthrough]];
-	case enumStage::QUIETS:
+	case enumStage::QUIETS: {
+		const size_t first_quiet = _move_list.count();
 		MoveGen::generatePseudoLegalMoves<MoveGen::QUIETS>(pos, _move_list);
+
+		if (!_threat_move.isNull())
+			_move_list.prioritizeOrigin(first_quiet, _threat_move.getTarget());
+
 		_stage = enumStage::PICK_QUIETS;
+	}
 
 		[[fallthrough]];
 	case enumStage::PICK_QUIETS:
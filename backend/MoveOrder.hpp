@@ -29,11 +29,9 @@ public:
 
 	void setHashMove(Move m);
 	void setKillerMove(Move m);
-	void setCounterMove(Move prev, Move curr, bool side);
+	void setThreatMove(Move m);
 
 	void clear();
-
-	static void clearCounterMoveHistory();
 private:
 	bool getFromList(Move& move);
 
@@ -55,8 +53,7 @@ private:
 	Move _hash_move		   = Move::null;
 	Move _killer_move	   = Move::null;
 	Move _counter		   = Move::null;
-
-	inline static Move _countermove[2][6][64] = {};
+	Move _threat_move	   = Move::null;
 
 	MoveList _move_list;
 };
@@ -67,6 +64,7 @@ INLINE void MoveOrder<Type>::clear() {
 	_stage = _first_stage;
 	_hash_move = Move::null;
 	_counter = Move::null;
+	_threat_move = Move::null;
 	_move_list.clear();
 }
 
@@ -80,12 +78,8 @@ INLINE void MoveOrder<Type>::setKillerMove(Move m) {
 	_killer_move = m;
 }
 
+// quiet moves escaping with a piece attacked by the threat move are picked first
 template <OrderType Type>
-INLINE void MoveOrder<Type>::setCounterMove(Move prev, Move curr, bool side) {
-	_countermove[side][prev.getPerformerT()][prev.getTarget()] = curr;
+INLINE void MoveOrder<Type>::setThreatMove(Move m) {
+	_threat_move = m;
 }
-
-template <OrderType Type>
-INLINE void MoveOrder<Type>::clearCounterMoveHistory() {
-	std::memset(_countermove, Move::null, sizeof(_countermove) / sizeof(Move));
-}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include "PackedPosition.hpp"
+
+PackedPosition PackedPosition::pack(const Position& pos) {
+	PackedPosition packed = {};
+	std::array<uint8_t, 64> codes;
+
+	for (enumColor side : { WHITE, BLACK }) {
+		for (auto piece_t : Piece::piece_list) {
+			for (uint64_t bb = pos.getPiecesBySide(side, piece_t); bb; bb &= bb - 1)
+				codes[Intrinsics::bitScanForward64(bb)] = static_cast<uint8_t>(side << 3 | piece_t);
+		}
+	}
+
+	packed.occupancy = pos.getOccupied();
+	assert(Intrinsics::popCount64(packed.occupancy) <= 32);
+
+	int i = 0;
+
+	for (uint64_t bb = packed.occupancy; bb; bb &= bb - 1, i++)
+		packed.pieces[i / 2] |= codes[Intrinsics::bitScanForward64(bb)] << (i % 2 * 4);
+
+	const CastlingRights white = pos.getCastlingByColor(WHITE),
+						 black = pos.getCastlingByColor(BLACK);
+
+	packed.fullmove_count = pos.fullmoveCount();
+	packed.state = static_cast<uint8_t>((pos.getTurn() == BLACK) | white.isShortPossible() << 1 | white.isLongPossible() << 2
+		| black.isShortPossible() << 3 | black.isLongPossible() << 4);
+	packed.ep_square = pos.getEnPassantSq().isNull() ? 64 : static_cast<uint8_t>(pos.getEnPassantSq());
+	packed.halfmove_count = pos.halfmoveClock();
+
+	return packed;
+}
+
+void PackedPosition::unpack(Position& pos) const {
+	std::array<std::array<BitBoard, 6>, 2> piece_bb = {};
+
+	int i = 0;
+
+	for (uint64_t bb = occupancy; bb; bb &= bb - 1, i++) {
+		const uint8_t code = pieces[i / 2] >> (i % 2 * 4) & 0xf;
+		piece_bb[code >> 3][code & 7] |= bb & (0 - bb);
+	}
+
+	const std::array<CastlingRights, 2> castling_rights = {
+		CastlingRights(state >> 1 & 1, state >> 2 & 1),
+		CastlingRights(state >> 3 & 1, state >> 4 & 1)
+	};
+
+	pos.setByPieces(piece_bb, state & 1 ? BLACK : WHITE, castling_rights,
+		ep_square < 64 ? Square(ep_square) : Square(Square::none), halfmove_count, fullmove_count);
+}
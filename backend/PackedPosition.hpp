@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Position.hpp"
+
+/*
+	Position in 32 bytes, written as it is in memory (little endian). Occupied squares are given by the bitboard,
+	their pieces by 4-bit codes (color << 3 | type) in order of the squares, the lower half of a byte first -
+	32 pieces fit into 16 bytes, the limit Fen::parse enforces. Unpacking doesn't check anything, so only packed
+	positions of Position can be unpacked.
+*/
+struct PackedPosition {
+	static PackedPosition pack(const Position& pos);
+	void unpack(Position& pos) const;
+
+	uint64_t occupancy;
+	std::array<uint8_t, 16> pieces;
+	uint16_t fullmove_count;
+	// side to move in bit 0, castling rights KQkq in bits 1-4
+	uint8_t state;
+	// en passant square, 64 when there is none
+	uint8_t ep_square;
+	uint8_t halfmove_count;
+	// zero, free for labels of the position
+	std::array<uint8_t, 3> reserved;
+};
+
+static_assert(sizeof(PackedPosition) == 32);
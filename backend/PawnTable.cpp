@@ -0,0 +1,16 @@
+#include "PawnTable.hpp"
+
+PawnTable::PawnTable()
+	: _mem(std::make_unique<PawnEntry[]>(_size)) {
+	static_assert(sizeof(PawnEntry) == 64);
+}
+
+void PawnTable::resetStats() {
+	_probes = 0;
+	_hits = 0;
+}
+
+void PawnTable::printStats() const {
+	std::cout << "info string pawn hash hits " << _hits << '/' << _probes
+		<< " (" << (_probes ? _hits * 100.f / _probes : 0.f) << "%)\n";
+}
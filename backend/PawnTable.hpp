@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Common.hpp"
+#include "BitBoard.hpp"
+#include "Intrinsics.hpp"
+#include "Score.hpp"
+
+#include <memory>
+
+// pawn structure of single pawn configuration, scored from white point of view
+struct alignas(64) PawnEntry {
+	uint64_t key;
+	PackedScore score;
+	// squares attacked by pawns, squares pawns may ever attack while advancing 
+	// and passed pawns, indexed by color
+	std::array<BitBoard, 2> attacks,
+							attack_span,
+							passed;
+};
+
+/*
+	Pawn structure changes only on pawn moves and captures of pawns, so the same pawn configuration
+	is evaluated over and over in the search. Entries are indexed by the pawn key of a position, 
+	maintained incrementally in make/unmake. Always-replace scheme, the table is owned by a single search thread.
+*/
+class PawnTable {
+public:
+	PawnTable();
+
+	// returns slot of given key, holding another pawn structure when key doesn't match
+	PawnEntry* probe(uint64_t key);
+	void prefetch(uint64_t key) const;
+
+	void resetStats();
+	void printStats() const;
+private:
+	static constexpr size_t _size = 16384;
+
+	std::unique_ptr<PawnEntry[]> _mem;
+
+	uint64_t _probes = 0,
+			 _hits = 0;
+};
+
+INLINE PawnEntry* PawnTable::probe(uint64_t key) {
+	PawnEntry* const entry = &_mem[key & (_size - 1)];
+
+	_probes++;
+	_hits += entry->key == key;
+
+	return entry;
+}
+
+INLINE void PawnTable::prefetch(uint64_t key) const {
+	Intrinsics::prefetch(&_mem[key & (_size - 1)]);
+}
@@ -0,0 +1,283 @@
+#include "Pgn.hpp"
+#include "MoveGen.hpp"
+
+namespace {
+
+	INLINE bool isSpace(char c) {
+		return c == ' ' or c == '\n' or c == '\r' or c == '\t';
+	}
+
+	INLINE bool isDigit(char c) {
+		return '0' <= c and c <= '9';
+	}
+
+	// characters ending a move token
+	INLINE bool isSeparator(char c) {
+		return isSpace(c) or c == '{' or c == '}' or c == '(' or c == ')' or c == ';' or c == '$';
+	}
+
+	// beginning of tag section placed right after an empty line, at or after given index
+	size_t gameStart(std::string_view text, size_t from) {
+		for (size_t idx = text.find("\n[", from); idx != std::string_view::npos; idx = text.find("\n[", idx + 1)) {
+			size_t prev = idx;
+
+			while (prev and (text[prev - 1] == '\r' or text[prev - 1] == ' ' or text[prev - 1] == '\t'))
+				prev--;
+
+			if (!prev or text[prev - 1] == '\n')
+				return idx + 1;
+		}
+
+		return text.size();
+	}
+
+	// [Name "Value"]
+	void parseTag(std::string_view line, PgnGame& game) {
+		const size_t name_end = line.find_first_of(" \t\""),
+					 value_begin = line.find('"'),
+					 value_end = line.rfind('"');
+
+		if (name_end == std::string_view::npos or value_begin == value_end)
+			return;
+
+		const std::string_view name = line.substr(1, name_end - 1),
+							   value = line.substr(value_begin + 1, value_end - value_begin - 1);
+
+		if (name == "FEN")
+			game.fen = value;
+		else if (name == "Result")
+			game.result = Pgn::parseResult(value);
+	}
+
+	INLINE bool isLegal(Position& pos, Move move) {
+		Position::IrreversibleState state;
+		const bool legal = pos.make(move, state);
+		pos.unmake(move, state);
+		return legal;
+	}
+
+	// fields of a move decoded from SAN
+	struct SanMove {
+		enum enumCastle : uint8_t {
+			NONE, SHORT, LONG
+		};
+
+		Piece::enumType piece_t = Piece::PAWN,
+						promo_t = Piece::NONE;
+		Square target = Square::none;
+		int org_file = -1,
+			org_rank = -1;
+		enumCastle castle = NONE;
+	};
+
+	template <MoveGen::enumMode GenType>
+	Move findMove(Position& pos, const SanMove& san_move) {
+		MoveList move_list;
+		MoveGen::generatePseudoLegalMoves<GenType>(pos, move_list);
+
+		for (size_t i = 0; i < move_list.count(); i++) {
+			const Move move = move_list.getMove(i);
+
+			if (san_move.castle != SanMove::NONE) {
+				if ((san_move.castle == SanMove::LONG ? move.isLongCastle() : move.isShortCastle()) and isLegal(pos, move))
+					return move;
+
+				continue;
+			}
+
+			if (move.getTarget() != san_move.target or move.getPerformerT() != san_move.piece_t
+				or move.isShortCastle() or move.isLongCastle())
+				continue;
+
+			if (san_move.promo_t == Piece::NONE ? move.isPromotion() 
+				: !move.isPromotion() or move.getPromoPieceT() != san_move.promo_t)
+				continue;
+
+			if ((san_move.org_file >= 0 and move.getOrigin().getFile() != san_move.org_file)
+				or (san_move.org_rank >= 0 and move.getOrigin().getRank() != san_move.org_rank))
+				continue;
+
+			// disambiguation leaves out moves of pinned pieces
+			if (isLegal(pos, move))
+				return move;
+		}
+
+		return Move::null;
+	}
+
+} // namespace
+
+bool PgnReader::next(PgnGame& game) {
+	game.fen = game.movetext = {};
+	game.result = PgnGame::UNKNOWN;
+
+	bool tags = false;
+
+	// tag pairs, one per line
+	for (;;) {
+		while (_idx < _text.size() and isSpace(_text[_idx]))
+			_idx++;
+
+		if (_idx == _text.size() or _text[_idx] != '[')
+			break;
+
+		const size_t line_end = std::min(_text.find('\n', _idx), _text.size());
+
+		parseTag(_text.substr(_idx, line_end - _idx), game);
+		tags = true;
+		_idx = line_end;
+	}
+
+	if (_idx == _text.size())
+		return tags;
+
+	// movetext lasts until next tag section
+	const size_t end = std::min(_text.find("\n[", _idx), _text.size());
+
+	game.movetext = _text.substr(_idx, end - _idx);
+	_idx = end;
+
+	return true;
+}
+
+std::vector<std::string_view> PgnReader::split(std::string_view text, size_t parts) {
+	std::vector<std::string_view> res;
+	size_t begin = 0;
+
+	for (size_t i = 1; i <= parts and begin < text.size(); i++) {
+		const size_t end = i == parts ? text.size() : gameStart(text, std::max(begin, text.size() / parts * i));
+
+		if (end > begin)
+			res.push_back(text.substr(begin, end - begin));
+
+		begin = end;
+	}
+
+	return res;
+}
+
+std::string_view Pgn::nextToken(std::string_view movetext, size_t& idx) {
+	const size_t size = movetext.size();
+
+	while (idx < size) {
+		const char c = movetext[idx];
+
+		if (isSpace(c) or c == '.' or c == ')' or c == '}')
+			idx++;
+		// comments
+		else if (c == '{')
+			idx = std::min(movetext.find('}', idx), size);
+		else if (c == ';' or c == '%')
+			idx = std::min(movetext.find('\n', idx), size);
+		// variations, possibly nested
+		else if (c == '(') {
+			for (int depth = 0; idx < size; idx++) {
+				if (movetext[idx] == '{')
+					idx = std::min(movetext.find('}', idx), size - 1);
+				else if (movetext[idx] == '(')
+					depth++;
+				else if (movetext[idx] == ')' and !--depth)
+					break;
+			}
+		}
+		// numeric annotation glyphs
+		else if (c == '$') {
+			for (idx++; idx < size and isDigit(movetext[idx]); idx++);
+		}
+		else if (c == '*')
+			return {};
+		// move number or game termination marker, but castling may be written with zeros
+		else if (isDigit(c) and movetext.substr(idx, 3) != "0-0") {
+			for (; idx < size and isDigit(movetext[idx]); idx++);
+
+			if (idx < size and (movetext[idx] == '-' or movetext[idx] == '/'))
+				return {};
+		}
+		else {
+			const size_t begin = idx;
+
+			for (; idx < size and !isSeparator(movetext[idx]); idx++);
+
+			return movetext.substr(begin, idx - begin);
+		}
+	}
+
+	return {};
+}
+
+Move Pgn::parseSan(Position& pos, std::string_view san) {
+	// check, mate and annotation suffixes
+	while (!san.empty() and (san.back() == '+' or san.back() == '#' or san.back() == '!' or san.back() == '?'))
+		san.remove_suffix(1);
+
+	if (san.size() < 2)
+		return Move::null;
+
+	SanMove san_move;
+
+	// castling, written with letter O or digit 0
+	if (san[0] == 'O' or san[0] == '0') {
+		san_move.castle = san.size() >= 5 ? SanMove::LONG : SanMove::SHORT;
+		return findMove<MoveGen::QUIETS>(pos, san_move);
+	}
+
+	if (san[0] == 'N' or san[0] == 'B' or san[0] == 'R' or san[0] == 'Q' or san[0] == 'K') {
+		san_move.piece_t = Piece::typeFromChar(san[0]);
+		san.remove_prefix(1);
+	}
+	// promotion piece, with or without '=' sign
+	else if (!isDigit(san.back())) {
+		if (std::string_view("NBRQnbrq").find(san.back()) == std::string_view::npos)
+			return Move::null;
+
+		san_move.promo_t = Piece::typeFromChar(san.back());
+		san.remove_suffix(1);
+
+		if (!san.empty() and san.back() == '=')
+			san.remove_suffix(1);
+	}
+
+	if (san.size() < 2)
+		return Move::null;
+
+	const char file = san[san.size() - 2],
+			   rank = san[san.size() - 1];
+
+	if (file < 'a' or 'h' < file or rank < '1' or '8' < rank)
+		return Move::null;
+
+	san_move.target = Square::fromChar(file, rank);
+
+	// origin file and rank disambiguation, capture and long notation signs
+	bool capture = false;
+
+	for (const char c : san.substr(0, san.size() - 2)) {
+		if ('a' <= c and c <= 'h')
+			san_move.org_file = c - 'a';
+		else if ('1' <= c and c <= '8')
+			san_move.org_rank = c - '1';
+		else if (c == 'x' or c == ':')
+			capture = true;
+		else if (c != '-')
+			return Move::null;
+	}
+
+	// only moves of the right kind are generated, quiet queen promotions are generated along with captures
+	const Move move = capture ? findMove<MoveGen::TACTICALS>(pos, san_move)
+		: san_move.promo_t == Piece::NONE ? findMove<MoveGen::QUIETS>(pos, san_move)
+		: Move(Move::null);
+
+	// promotions and captures without capture sign, which sloppy notation leaves out
+	return move.isNull() ? findMove<MoveGen::ALL>(pos, san_move) : move;
+}
+
+PgnGame::enumResult Pgn::parseResult(std::string_view result) {
+	if (result == "1-0")
+		return PgnGame::WHITE_WIN;
+	else if (result == "0-1")
+		return PgnGame::BLACK_WIN;
+	else if (result == "1/2-1/2")
+		return PgnGame::DRAW;
+
+	return PgnGame::UNKNOWN;
+}
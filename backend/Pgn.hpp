@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Position.hpp"
+#include "Move.hpp"
+
+#include <vector>
+
+// one game of PGN text - all the fields are views into the text, there are no copies
+struct PgnGame {
+	enum enumResult : uint8_t {
+		WHITE_WIN, BLACK_WIN, DRAW, UNKNOWN
+	};
+
+	std::string_view fen, movetext;
+	enumResult result;
+};
+
+/*
+	Streaming PGN reader over text kept in memory, usually a mapped file. Games are read one
+	by one: tag pairs are parsed on the fly, only FEN and Result tags are kept, and movetext
+	is given as a raw view - it ends where the next tag section starts, so movetext of a game
+	doesn't have to be tokenized further than it's needed.
+*/
+class PgnReader {
+public:
+	PgnReader(std::string_view text)
+		: _text(text) {}
+
+	// returns false when there are no more games
+	bool next(PgnGame& game);
+
+	// cuts the text into roughly equal parts, each one starting at a game boundary,
+	// so the parts can be read independently
+	static std::vector<std::string_view> split(std::string_view text, size_t parts);
+private:
+	std::string_view _text;
+	size_t _idx = 0;
+};
+
+namespace Pgn {
+
+	// next move token of movetext, starting from idx. Move numbers, comments, variations
+	// and NAGs are skipped. Returns empty view at the end of movetext or at game termination marker.
+	std::string_view nextToken(std::string_view movetext, size_t& idx);
+
+	// decodes move in Standard Algebraic Notation, returns null move when there is no such legal move
+	Move parseSan(Position& pos, std::string_view san);
+
+	PgnGame::enumResult parseResult(std::string_view result);
+
+} // namespace Pgn
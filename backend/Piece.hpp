@@ -7,7 +7,7 @@
 
 class Piece {
 public:
-	enum enumType;
+	enum enumType : uint8_t;
 
 	Piece() = default;
 	inline Piece(enumType piece_t) { set(WHITE, piece_t); }
@@ -1,4 +1,5 @@
 #include "Position.hpp"
+#include "Fen.hpp"
 #include "Move.hpp"
 #include "MoveGen.hpp"
 #include "Time.hpp"
@@ -17,39 +18,36 @@ Position::Position() { setStartingPos(); }
 
 Position::Position(const std::string init_fen) { setByFEN(init_fen); }
 
-Position::Position(const std::string_view init_fen) { setByFEN(static_cast<std::string>(init_fen)); }
+Position::Position(const std::string_view init_fen) { setByFEN(init_fen); }
 
-void Position::setByFEN(const std::string fen) {
-	clearPieces();
-
-	int x = 0, y = 7;
+void Position::setByFEN(std::string_view fen) {
+	Fen::parse(fen, *this);
+}
 
-	for (int i = 0; i < size(fen); i++) {
-		const char c = fen[i];
+void Position::setStartingPos() {
+	setByFEN(starting_fen);
+}
 
-		if (isdigit(c)) {
-			x += c - '0';
-			continue;
-		}
-		else if (c == ' ') {
-			setGameStatesFromStr(fen, i + 1);
-			break;
-		}
+void Position::setByPieces(const std::array<std::array<BitBoard, 6>, 2>& pieces, enumColor turn) {
+	setByPieces(pieces, turn, {}, Square::none, 0, 1);
+}
 
-		int in = y * 8 + x;
-		if (c == '/') {
-			y--, x = 0;
-			continue;
-		}
+void Position::setByPieces(const std::array<std::array<BitBoard, 6>, 2>& pieces, enumColor turn,
+	const std::array<CastlingRights, 2>& castling_rights, Square ep_square, uint8_t halfmove_count, uint16_t fullmove_count) {
+	_piece_bb = pieces;
+	_turn = turn;
+	_castling_rights = castling_rights;
+	_ep_square = ep_square;
+	_halfmove_count = halfmove_count;
+	_null_plies = 0;
+	_fullmove_count = fullmove_count;
 
-		const enumColor col = islower(c) ? BLACK : WHITE;
-		_piece_bb[col][Piece::fromChar(col, c).toIndex()].setBit(in);
-		++x;
-	}
-}
+	_king_sq[WHITE] = getKingBySide(WHITE).bitScanForward();
+	_king_sq[BLACK] = getKingBySide(BLACK).bitScanReverse();
 
-void Position::setStartingPos() {
-	setByFEN(static_cast<std::string>(starting_fen));
+	_hashing._key = _hashing.generateOnFly(*this);
+	_hashing._pawn_key = _hashing.generatePawnKeyOnFly(*this);
+	_hashing._material_key = _hashing.generateMaterialKeyOnFly(*this);
 }
 
 void Position::print() const {
@@ -97,12 +95,17 @@ bool Position::make(Move& move, IrreversibleState& state) {
 
 	// TEMPORARY
 	state.hash_key = _hashing._key;
+	state.pawn_key = _hashing._pawn_key;
+	state.material_key = _hashing._material_key;
 
 	if (capture) {
 		if (move.isEnPassant()) {
 			assert(piece_t == Piece::PAWN);
 			_piece_bb[!_turn][Piece::PAWN].popBit(dst - dir);
 			_hashing._key ^= _hashing._piece_keys[!_turn][Piece::PAWN][dst - dir];
+			_hashing._pawn_key ^= _hashing._piece_keys[!_turn][Piece::PAWN][dst - dir];
+			_hashing._material_key ^= 
+				_hashing._piece_keys[!_turn][Piece::PAWN][_piece_bb[!_turn][Piece::PAWN].popCount()];
 		}
 		else {
 			const Piece::enumType captured = pieceTypeOn(dst, !_turn);
@@ -112,6 +115,10 @@ bool Position::make(Move& move, IrreversibleState& state) {
 
 			_piece_bb[!_turn][captured].popBit(dst);
 			_hashing._key ^= _hashing._piece_keys[!_turn][captured][dst];
+			_hashing._material_key ^= _hashing._piece_keys[!_turn][captured][_piece_bb[!_turn][captured].popCount()];
+
+			if (captured == Piece::PAWN)
+				_hashing._pawn_key ^= _hashing._piece_keys[!_turn][Piece::PAWN][dst];
 
 			const Square RightCornerOpponent = _turn == BLACK ? Square::h1 : Square::h8,
 				LeftCornerOpponent = _turn == BLACK ? Square::a1 : Square::a8;
@@ -136,12 +143,22 @@ bool Position::make(Move& move, IrreversibleState& state) {
 
 		_hashing._key ^= _hashing._piece_keys[_turn][piece_t][org];
 		_hashing._key ^= _hashing._piece_keys[_turn][promo_piece_t][dst];
+		_hashing._pawn_key ^= _hashing._piece_keys[_turn][piece_t][org];
+
+		_hashing._material_key ^= _hashing._piece_keys[_turn][piece_t][_piece_bb[_turn][piece_t].popCount()];
+		_hashing._material_key ^= 
+			_hashing._piece_keys[_turn][promo_piece_t][_piece_bb[_turn][promo_piece_t].popCount() - 1];
 	}
 	else { // if not a promotion - just move a piece on its own bitboard 
 		_piece_bb[_turn][piece_t].moveBit(org, dst);
 
 		_hashing._key ^= _hashing._piece_keys[_turn][piece_t][org];
 		_hashing._key ^= _hashing._piece_keys[_turn][piece_t][dst];
+
+		if (piece_t == Piece::PAWN) {
+			_hashing._pawn_key ^= _hashing._piece_keys[_turn][Piece::PAWN][org];
+			_hashing._pawn_key ^= _hashing._piece_keys[_turn][Piece::PAWN][dst];
+		}
 	}
 
 	if (piece_t == Piece::KING) {
@@ -195,6 +212,7 @@ bool Position::make(Move& move, IrreversibleState& state) {
 		_halfmove_count = capture or pawn_push or double_pawn_push ? 0 : _halfmove_count + 1;
 	}
 
+	_null_plies++;
 	_fullmove_count += static_cast<int>(_turn);
 	_turn = !_turn;
 
@@ -249,6 +267,7 @@ void Position::unmake(Move move, const IrreversibleState& prev_state) {
 		_king_sq[_turn] = org;
 	}
 
+	_null_plies--;
 	_fullmove_count -= static_cast<int>(_turn);
 
 	// recover old states that are irreversible
@@ -258,10 +277,16 @@ void Position::unmake(Move move, const IrreversibleState& prev_state) {
 
 	// TEMPORARY
 	_hashing._key = prev_state.hash_key;
+	_hashing._pawn_key = prev_state.pawn_key;
+	_hashing._material_key = prev_state.material_key;
 }
 
 void Position::makeNull(IrreversibleState& state) {
-	_halfmove_count++;
+	// repetitions can't span a null move, so the count restarts and bounds repetition detection
+	// in the subtree, while the halfmove clock keeps running for the 50-move rule and tablebases
+	state.halfmove_count = _halfmove_count;
+	state.null_plies = _null_plies;
+	_null_plies = 0;
 	_fullmove_count += static_cast<uint16_t>(_turn);
 
 	state.hash_key = _hashing._key;
@@ -280,7 +305,8 @@ void Position::makeNull(IrreversibleState& state) {
 void Position::unmakeNull(const IrreversibleState& prev_state) {
 	_turn = !_turn;
 	
-	_halfmove_count--;
+	_halfmove_count = prev_state.halfmove_count;
+	_null_plies = prev_state.null_plies;
 	_fullmove_count -= static_cast<uint16_t>(_turn);
 
 	_hashing._key = prev_state.hash_key;
@@ -310,6 +336,8 @@ uint64_t Position::perft(unsigned depth) {
 
 		if (make(move, state)) {
 			assert(_hashing._key == _hashing.generateOnFly(*this));
+			assert(_hashing._pawn_key == _hashing.generatePawnKeyOnFly(*this));
+			assert(_hashing._material_key == _hashing.generateMaterialKeyOnFly(*this));
 
 			child_nodes = perft<false>(depth - 1);
 			nodes += child_nodes;
@@ -338,59 +366,6 @@ uint64_t Position::perft(unsigned depth) {
 template uint64_t Position::perft<false>(unsigned depth);
 template uint64_t Position::perft<true>(unsigned depth);
 
-void Position::setGameStatesFromStr(const std::string fen, int i) {
-	_turn.fromChar(fen[i]);
-
-	i += 2;
-	_castling_rights[WHITE].clear(), _castling_rights[BLACK].clear();
-
-	for (; fen[i] != ' '; i++) {
-		switch (fen[i]) {
-		case 'K':
-			_castling_rights[WHITE].setKingSide(true);
-			break;
-		case 'Q':
-			_castling_rights[WHITE].setQueenSide(true);
-			break;
-		case 'k':
-			_castling_rights[BLACK].setKingSide(true);
-			break;
-		case 'q':
-			_castling_rights[BLACK].setQueenSide(true);
-			break;
-		default:
-			break;
-		}
-	}
-
-	_ep_square = Square::none;
-
-	if (fen[++i] != '-') {
-		_ep_square = Square::fromChar(fen[i], fen[i + 1]);
-	}
-
-	i += 2;
-
-	_halfmove_count = 0;
-	for (; fen[i] != ' '; i++) {
-		_halfmove_count *= 10;
-		_halfmove_count += fen[i] - '0';
-	}
-
-	i++;
-
-	_fullmove_count = 0;
-	for (; i < size(fen) and fen[i] != ' '; i++) {
-		_fullmove_count *= 10;
-		_fullmove_count += fen[i] - '0';
-	}
-
-	_king_sq[WHITE] = getKingBySide(WHITE).bitScanForward();
-	_king_sq[BLACK] = getKingBySide(BLACK).bitScanReverse();
-
-	_hashing._key = _hashing.generateOnFly(*this);
-}
-
 /*
 INLINE BitBoard Position::leastValuableAttacker_withMask(const Square sq, enumColor attacked, BitBoard occupied, 
 	BitBoard mask, Piece::enumType& attacker) const {
@@ -468,7 +443,7 @@ int Position::StaticExchangeEval(const Square sq) const {
 		100, 300, 300, 500, 900, 10000
 	};
 
-	static auto get_weakest_from = [this](BitBoard bb, enumColor side) _LAMBDA_FORCEINLINE {
+	const auto get_weakest_from = [this](BitBoard bb, enumColor side) _LAMBDA_FORCEINLINE {
 		for (auto p : Piece::piece_list)
 			if (_piece_bb[side][p] & bb) return p;
 		return Piece::NONE;
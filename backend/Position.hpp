@@ -25,6 +25,10 @@ public:
 		return _queenside;
 	}
 
+	INLINE bool isAnyPossible() const {
+		return _kingside or _queenside;
+	}
+
 	template <enumColor Side>
 	bool notThroughCheck_Short(const Position& pos) const;
 	bool notThroughCheck_Short(const Position& pos, enumColor side) const;
@@ -66,12 +70,21 @@ public:
 	Position(const std::string init_fen);
 	Position(const std::string_view init_fen);
 
-	// assuming given FEN is valid FEN position
-	void setByFEN(const std::string fen);
+	// assuming given FEN is valid FEN position, Fen::parse tells what's wrong with an invalid one
+	void setByFEN(std::string_view fen);
 	void setStartingPos();
+	// sets given pieces, with no castling rights and no en passant square
+	void setByPieces(const std::array<std::array<BitBoard, 6>, 2>& pieces, enumColor turn);
+	// pieces with the whole state of the game, as kept by a packed position
+	void setByPieces(const std::array<std::array<BitBoard, 6>, 2>& pieces, enumColor turn,
+		const std::array<CastlingRights, 2>& castling_rights, Square ep_square, uint8_t halfmove_count, uint16_t fullmove_count);
 
 	void print() const;
 
+	INLINE BitBoard getPiecesBySide(enumColor col_type, Piece::enumType piece_t) const {
+		return _piece_bb[col_type][piece_t];
+	}
+
 	INLINE BitBoard getPawnsBySide(enumColor col_type) const {
 		return _piece_bb[col_type][Piece::PAWN];
 	}
@@ -104,6 +117,11 @@ public:
 		return _piece_bb[col_type][Piece::KING];
 	}
 
+	INLINE bool hasNonPawnMaterial(enumColor col_type) const {
+		return _piece_bb[col_type][Piece::KNIGHT] | _piece_bb[col_type][Piece::BISHOP]
+			| _piece_bb[col_type][Piece::ROOK] | _piece_bb[col_type][Piece::QUEEN];
+	}
+
 	INLINE Square getKingSquare(enumColor col_type) const {
 		return _king_sq[col_type];
 	}
@@ -161,10 +179,25 @@ public:
 		return _halfmove_count;
 	}
 
+	// plies back to the earliest position that can repeat: neither an irreversible move nor a null move is crossed
+	INLINE int repetitionPlies() const {
+		return std::min<int>(_halfmove_count, _null_plies);
+	}
+
+	INLINE uint16_t fullmoveCount() const {
+		return _fullmove_count;
+	}
+
 	INLINE void setTurn(enumColor col_to_move) {
 		_turn = col_to_move;
 	}
 
+	// counters aren't a part of the keys, EPD may give them apart from the position fields
+	INLINE void setMoveCounters(uint8_t halfmove_count, uint16_t fullmove_count) {
+		_halfmove_count = halfmove_count;
+		_fullmove_count = fullmove_count;
+	}
+
 	// returns true whether square is attacked by any opposide-color piece excluding enemy king
 	bool attacked(Square sq, enumColor side) const;
 
@@ -174,6 +207,9 @@ public:
 	BitBoard attacksTo(Square sq, enumColor side, BitBoard occ) const;
 
 	bool isInCheck(enumColor side) const;
+
+	// returns true when there is no sequence of legal moves leading to a mate
+	bool isInsufficientMaterial() const;
 	bool isInDoubleCheck(enumColor side) const;
 
 	BitBoard leastValuableAttackers(Square sq, enumColor side) const;
@@ -193,6 +229,8 @@ public:
 	void unmakeNull(const IrreversibleState& prev_state);
 
 	uint64_t getZobristKey() const;
+	uint64_t getPawnKey() const;
+	uint64_t getMaterialKey() const;
 
 	template <bool Root = true>
 	uint64_t perft(unsigned depth);
@@ -202,17 +240,18 @@ public:
 	struct IrreversibleState {
 		Square ep_sq;
 		uint8_t halfmove_count;
+		// saved by null moves only, other moves count it up and down
+		uint16_t null_plies;
 		std::array<CastlingRights, 2> castling_rights;
 		// TEMPORARY
-		uint64_t hash_key;
+		uint64_t hash_key,
+				 pawn_key,
+				 material_key;
 	};
 
 	static constexpr std::string_view starting_fen 
 		= "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
 private:
-	void clearPieces();
-	void setGameStatesFromStr(const std::string fen, int i);
-
 	//BitBoard leastValuableAttacker_withMask(const Square sq, enumColor side, 
 	//BitBoard occupied, BitBoard mask, Piece::enumType& attacker) const;
 
@@ -222,6 +261,8 @@ private:
 	std::array<CastlingRights, 2> _castling_rights;
 	Square _ep_square;
 	uint8_t _halfmove_count;
+	// plies since the last null move or since the position was set
+	uint16_t _null_plies;
 
 	uint16_t _fullmove_count;
 
@@ -295,11 +336,6 @@ INLINE BitBoard Position::getByColor(enumColor col_type) const {
 		| _piece_bb[col_type][Piece::KING];
 }
 
-INLINE void Position::clearPieces() {
-	for (enumColor col : { WHITE, BLACK })
-		_piece_bb[col].fill(BitBoard::empty);
-}
-
 template <Piece::enumType Piece, enumColor Color>
 INLINE BitBoard Position::get() const {
 	if constexpr (Piece == Piece::PAWN)
@@ -347,6 +383,24 @@ INLINE bool Position::isInCheck(enumColor side) const {
 	return attacked(king_sq, side);
 }
 
+INLINE bool Position::isInsufficientMaterial() const {
+	static constexpr uint64_t dark_squares = 0xaa55aa55aa55aa55ULL;
+
+	for (enumColor col : { WHITE, BLACK }) {
+		if (_piece_bb[col][Piece::PAWN] | _piece_bb[col][Piece::ROOK] | _piece_bb[col][Piece::QUEEN])
+			return false;
+	}
+
+	const BitBoard knights = _piece_bb[WHITE][Piece::KNIGHT] | _piece_bb[BLACK][Piece::KNIGHT],
+				   bishops = _piece_bb[WHITE][Piece::BISHOP] | _piece_bb[BLACK][Piece::BISHOP];
+
+	// lone minor piece, or any number of bishops standing on the same color squares
+	if ((knights | bishops).popCount() <= 1)
+		return true;
+
+	return !knights and (!(bishops & dark_squares) or !(bishops & ~dark_squares));
+}
+
 INLINE bool Position::isInDoubleCheck(enumColor side) const {
 	const Square king_sq = getKingSquare(side);
 	const BitBoard occupied = getOccupied();
@@ -415,4 +469,12 @@ INLINE Piece Position::pieceOn(Square sq) const {
 
 INLINE uint64_t Position::getZobristKey() const {
 	return _hashing._key;
+}
+
+INLINE uint64_t Position::getPawnKey() const {
+	return _hashing._pawn_key;
+}
+
+INLINE uint64_t Position::getMaterialKey() const {
+	return _hashing._material_key;
 }
\ No newline at end of file
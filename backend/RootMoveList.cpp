@@ -0,0 +1,46 @@
+#include "RootMoveList.hpp"
+#include "MoveGen.hpp"
+
+void RootMoveList::generate(Position& pos, const MoveList& search_moves) {
+	MoveList move_list;
+	MoveGen::generatePseudoLegalMoves<MoveGen::ALL>(pos, move_list);
+
+	Position::IrreversibleState state;
+
+	// if none of the given searchmoves is legal, fall back to all the legal moves
+	for (const bool restricted : { search_moves.count() != 0, false }) {
+		_idx = 0;
+
+		for (size_t i = 0; i < move_list.count(); i++) {
+			Move move = move_list.getMove(i);
+
+			if (restricted and !search_moves.contains(move))
+				continue;
+
+			if (pos.make(move, state))
+				_moves[_idx++] = RootMove{ move, Score(-Score::infinity), 0, 0 };
+
+			pos.unmake(move, state);
+		}
+
+		if (_idx or !restricted)
+			break;
+	}
+}
+
+void RootMoveList::sort() {
+	std::stable_sort(_moves.data(), _moves.data() + _idx, [](const RootMove& a, const RootMove& b) {
+		return a.score != b.score ? a.score > b.score : a.nodes > b.nodes;
+	});
+}
+
+void RootMoveList::keepBestRanked() {
+	int best_rank = std::numeric_limits<int>::min();
+
+	for (size_t i = 0; i < _idx; i++)
+		best_rank = std::max(best_rank, _moves[i].tb_rank);
+
+	_idx = static_cast<size_t>(std::remove_if(_moves.data(), _moves.data() + _idx, [best_rank](const RootMove& root_move) {
+		return root_move.tb_rank < best_rank;
+	}) - _moves.data());
+}
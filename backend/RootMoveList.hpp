@@ -0,0 +1,57 @@
+#pragma once
+
+#include "MoveList.hpp"
+#include "Score.hpp"
+
+// single root move with informations gathered while searching its subtree
+// in the last completed iteration
+struct RootMove {
+	Move move;
+	Score score;
+	uint64_t nodes;
+	// tablebase rank, moves with lower rank are dropped
+	int tb_rank;
+};
+
+/*
+	Root moves are kept apart from the staged move picker of interior nodes.
+	The list contains only legal moves (optionally restricted by UCI 'searchmoves')
+	and is reordered after every iteration - first by score of the moves,
+	then by size of their subtrees.
+*/
+
+class RootMoveList {
+public:
+	// generate all legal moves in the root position. If search_moves list isn't empty,
+	// only moves from that list are kept.
+	void generate(Position& pos, const MoveList& search_moves);
+
+	// order moves for the next iteration
+	void sort();
+
+	// keep only the moves with the highest tablebase rank
+	void keepBestRanked();
+
+	INLINE RootMove& operator[](size_t idx) {
+		assert(idx < _idx);
+		return _moves[idx];
+	}
+
+	INLINE const RootMove& operator[](size_t idx) const {
+		assert(idx < _idx);
+		return _moves[idx];
+	}
+
+	INLINE size_t count() const {
+		return _idx;
+	}
+
+	INLINE bool empty() const {
+		return _idx == 0;
+	}
+
+	INLINE void clear() { _idx = 0; }
+private:
+	size_t _idx = 0;
+	std::array<RootMove, max_node_moves> _moves;
+};
@@ -77,3 +77,64 @@ inline std::string Score::toStr() const {
 
 	return "cp " + std::to_string(_raw);
 }
+
+
+/*
+	Pair of middlegame and endgame scores packed into a single 32-bit integer: endgame part
+	in the upper half, middlegame part in the lower one. Both halves are added and subtracted
+	by single integer instructions and the scores are interpolated by game phase just once, 
+	at the end of evaluation.
+*/
+class PackedScore {
+public:
+	INLINE PackedScore() = default;
+	INLINE constexpr PackedScore(int16_t mg, int16_t eg)
+		: _raw((static_cast<uint32_t>(eg) << 16) + static_cast<uint32_t>(mg)) {}
+
+	INLINE constexpr PackedScore operator+(PackedScore b) const {
+		return PackedScore(_raw + b._raw);
+	}
+
+	INLINE constexpr PackedScore operator+=(PackedScore b) {
+		return PackedScore(_raw += b._raw);
+	}
+
+	INLINE constexpr PackedScore operator-(PackedScore b) const {
+		return PackedScore(_raw - b._raw);
+	}
+
+	INLINE constexpr PackedScore operator-=(PackedScore b) {
+		return PackedScore(_raw -= b._raw);
+	}
+
+	INLINE constexpr PackedScore operator-() const {
+		return PackedScore(0 - _raw);
+	}
+
+	INLINE constexpr PackedScore operator*(int n) const {
+		return PackedScore(_raw * static_cast<uint32_t>(n));
+	}
+
+	INLINE constexpr int16_t mg() const {
+		return static_cast<int16_t>(static_cast<uint16_t>(_raw));
+	}
+
+	// middlegame part is moved into unsigned range first, so its borrow doesn't affect the upper half
+	INLINE constexpr int16_t eg() const {
+		return static_cast<int16_t>(static_cast<uint16_t>((_raw + 0x8000) >> 16));
+	}
+
+	// Phase is a weight of middlegame score, from 0 up to max_phase. Division by power of two 
+	// compiles to shifts, yet unlike plain shift it rounds toward zero, keeping the result symmetric for both colors.
+	INLINE constexpr int16_t taper(int phase) const {
+		return static_cast<int16_t>(eg() + (mg() - eg()) * phase / max_phase);
+	}
+
+	static constexpr int phase_shift = 7,
+						 max_phase = 1 << phase_shift;
+private:
+	INLINE explicit constexpr PackedScore(uint32_t raw)
+		: _raw(raw) {}
+
+	uint32_t _raw;
+};
@@ -3,21 +3,27 @@
 #include "MoveGen.hpp"
 #include "Time.hpp"
 #include "TranspositionTable.hpp"
+#include "Syzygy.hpp"
 
 #include <sstream>
 
-INLINE bool SearchLimits::isTimeLeft() {
-	timer.stop();
-	return !search_time or timer.duration() < search_time;
-}
-
 INLINE void SearchResults::registerBestMove(Move move) {
 	best_move = move;
 }
 
-INLINE void SearchResults::printBestMove() {
-	ASSERT(!best_move.isNull(), "Null bestmove error");
+INLINE void SearchResults::registerNullCutoff(uint64_t saved_nodes) {
+	null_cutoffs++;
+	null_saved_nodes += saved_nodes;
+}
+
+void SearchResults::printStats() const {
+	std::cout << "info string null move cutoffs " << null_cutoffs << '/' << null_tries
+		<< " (" << (null_tries ? null_cutoffs * 100.f / null_tries : 0.f) << "%)"
+		<< " avg saved nodes " << (null_cutoffs ? null_saved_nodes / null_cutoffs : 0) << '\n';
+}
 
+INLINE void SearchResults::printBestMove() {
+	// null move is sent only when there is no legal move in the root position
 	std::cout << "bestmove ";
 	best_move.print();
 	std::cout << '\n';
@@ -26,7 +32,25 @@ INLINE void SearchResults::printBestMove() {
 Search::Search(TranspositionTable& tt)
 	: _tt(tt) {}
 
-INLINE void SearchResults::print(const Search* search, const Position& pos) {
+INLINE void Search::registerSubtree(unsigned depth, uint64_t nodes) {
+	_subtree_nodes[depth] += nodes;
+	_subtree_cnt[depth]++;
+}
+
+INLINE uint64_t Search::nullSavedNodes(unsigned depth, uint64_t null_nodes) const {
+	if (!_subtree_cnt[depth])
+		return 0;
+
+	return static_cast<uint64_t>(std::max<int64_t>(static_cast<int64_t>(_subtree_nodes[depth] / _subtree_cnt[depth])
+		- static_cast<int64_t>(null_nodes), 0));
+}
+
+void Search::printStats() const {
+	_results.printStats();
+	_eval.printStats();
+}
+
+INLINE void SearchResults::print() {
 	const auto duration_ms = timer.duration();
 	const uint64_t nps = static_cast<uint64_t>((nodes_cnt * 1000.f) / (duration_ms ? duration_ms : 1));
 
@@ -36,128 +60,390 @@ INLINE void SearchResults::print(const Search* search, const Position& pos) {
 		<< " nodes " << nodes_cnt
 		<< " time " << duration_ms 
 		<< " nps " << nps 
+		<< " tbhits " << tb_hits
 		<< " hashfull " << static_cast<unsigned>(static_cast<float>(tt_hits) / tt_entries * 1000)
 		<< " pv ";
 
-	Position cpy = pos;
-
-	while (depth--) {
-		TTEntry tt_entry;
-		const bool tt_hit = search->_tt.probe(tt_entry, cpy.getZobristKey(), -Score::infinity, +Score::infinity, depth, 0);
-
-		Move pv_move = tt_entry.move;
-
-		if (!tt_hit or pv_move.isNull()) 
-			break;
-
-		pv_move.print(), std::cout << ' ';
-
-		Position::IrreversibleState tmp;
-		cpy.make(pv_move, tmp);
-	}
+	for (size_t i = 0; i < pv.count(); i++)
+		pv.getMove(i).print(), std::cout << ' ';
 
 	std::cout << '\n';
 }
 
-void Search::bestMove(Position& pos, const Game& game, SearchLimits limits) {
+uint64_t Search::bestMove(Position& pos, const Game& game, SearchLimits limits) {
 	ASSERT(1 <= limits.depth and limits.depth < max_depth, "Invalid depth");
 
 	limits.timer.go();
 	limits.search_time = TimeMan::searchTime(pos, limits);
 
-	iterativeDeepening(pos, game, limits);
+	// game history is followed by keys of the nodes on the current search path
+	_root_key_idx = static_cast<unsigned>(game.currentHalfCount());
+
+	for (unsigned i = 0; i < _root_key_idx; i++)
+		_key_stack[i] = game.getPrevKey(i);
+
+	_key_stack[_root_key_idx] = pos.getZobristKey();
+
+	return iterativeDeepening(pos, limits);
 }
 
-void Search::iterativeDeepening(Position& pos, const Game& game, SearchLimits& limits) {
+uint64_t Search::iterativeDeepening(Position& pos, SearchLimits& limits) {
 	SearchResults search_results;
 	search_results.tt_entries = _tt.getEntriesCount();
 
+	uint64_t total_nodes = 0;
+
+	_eval.resetStats();
+	_subtree_nodes.fill(0);
+	_subtree_cnt.fill(0);
+	_root_moves.generate(pos, limits.search_moves);
+
+	// checkmate or stalemate in the root position
+	if (_root_moves.empty()) {
+		search_results.score_cp = pos.isInCheck(pos.getTurn()) ? Score(-Score::infinity) : Score(Score::draw);
+		_results = search_results;
+
+		if (_print_info) {
+			std::cout << "info depth 0 score " << (pos.isInCheck(pos.getTurn()) ? "mate 0" : "cp 0") << '\n';
+			search_results.printBestMove();
+		}
+
+		return 0;
+	}
+
+	_tb_cardinality = Syzygy::maxCardinality();
+
+	// Root position in tablebases: only moves that keep the best result are searched. When DTZ tables
+	// have ranked the moves or there is no win to find anyway, the search doesn't need to probe.
+	if (Syzygy::isProbeable(pos)) {
+		bool dtz_ranked = false;
+
+		if (Syzygy::rankRootMoves(pos, _root_moves, hasRepeated(pos), dtz_ranked)) {
+			search_results.tb_hits += _root_moves.count();
+
+			if (dtz_ranked or _root_moves[0].tb_rank <= 0)
+				_tb_cardinality = 0;
+		}
+	}
+
+	// always have a legal move in case the very first iteration gets interrupted
+	search_results.registerBestMove(_root_moves[0].move);
+
 	for (unsigned d = 1; d <= limits.depth; d++) {
+		search_results.prev_nodes = total_nodes;
 		search_results.nodes_cnt = 0;
 		search_results.depth = d;
 
 		_tree.clear();
 
-		if (!search(pos, game, limits, search_results))
+		const bool completed = search(pos, limits, search_results);
+		total_nodes += search_results.nodes_cnt;
+
+		if (!completed) {
+			search_results.depth = d - 1;
 			break;
+		}
+
+		_root_moves.sort();
+		search_results.registerBestMove(_root_moves[0].move);
 
-		search_results.registerBestMove(_tree.getNode(0).best_move);
+		limits.timer.stop();
+		search_results.iterations.push_back({ _root_moves[0].move, search_results.score_cp, limits.timer.duration(), total_nodes });
 	}
 
-	search_results.printBestMove();
+	search_results.nodes_cnt = total_nodes;
+	_results = search_results;
+
+	if (_print_info)
+		search_results.printBestMove();
+
+	return total_nodes;
 }
 
-bool Search::search(Position& pos, const Game& game, SearchLimits& limits, SearchResults& results) {
+bool Search::search(Position& pos, SearchLimits& limits, SearchResults& results) {
 	results.timer.go();
 
 	const Score score 
-		= -negaMax<true>(pos, limits, results, game, -Score::infinity, +Score::infinity, results.depth, 0);
+		= rootSearch(pos, limits, results, -Score::infinity, +Score::infinity, results.depth);
 
-	if (results.depth > 1 and !score.isValid())
+	if (!score.isValid())
 		return false;
 
 	results.timer.stop();
-	results.print(this, pos);
+	storePv(pos, results);
+
+	if (_print_info)
+		results.print();
 
 	return true;
 }
 
-template <bool Root, Search::enumNode NodeType, bool NullMove>
-Score Search::negaMax(Position& pos, SearchLimits& limits, SearchResults& results, const Game& game, 
-	Score alpha, Score beta, unsigned depth, unsigned ply) {
-	if constexpr (!Root) {
-		if (pos.halfmoveClock() >= 100 or isRepetitionCycle(pos, game, ply)) {
-			return Score::draw;
+void Search::storePv(Position pos, SearchResults& results) {
+	results.pv.clear();
+
+	Move move = _tree.getNode(0).best_move;
+
+	for (unsigned depth = results.depth; depth and !move.isNull(); depth--) {
+		Position::IrreversibleState state;
+
+		if (!move.isPseudoLegal(pos) or !pos.make(move, state))
+			break;
+
+		results.pv.push(std::move(move));
+
+		TTEntry tt_entry;
+		const bool tt_hit = depth > 1
+			and _tt.probe(tt_entry, pos.getZobristKey(), -Score::infinity, +Score::infinity, depth - 2, 0);
+
+		move = tt_hit ? tt_entry.move : Move::null;
+	}
+}
+
+/*
+	Root node is searched apart from the interior nodes. Moves are taken from the root move list
+	in order established by the previous iteration. Only the first move is searched with full window,
+	the rest of them are probed with null window and re-searched only when they turn out to be better.
+	Returns Score::undef when the search was interrupted.
+*/
+
+Score Search::rootSearch(Position& pos, SearchLimits& limits, SearchResults& results,
+	Score alpha, Score beta, unsigned depth) {
+	assert(!_root_moves.empty());
+
+	results.nodes_cnt++;
+
+	NodeInfo& node = _tree.getNode(0);
+
+	node.check = pos.isInCheck(pos.getTurn());
+	node.can_move = true;
+	node.score = 0;
+	node.ply = 0;
+	node.best_move = Move::null;
+	node.best_score = -Score::infinity;
+
+	TTEntry::Bound bound_type = TTEntry::LOWERBOUND;
+
+	for (size_t i = 0; i < _root_moves.count(); i++) {
+		RootMove& root_move = _root_moves[i];
+		const uint64_t nodes_before = results.nodes_cnt;
+
+		node.move = root_move.move;
+
+		limits.timer.stop();
+		if (_print_info and limits.timer.duration() >= _currmove_info_ms) {
+			std::cout << "info depth " << depth << " currmove ";
+			node.move.print();
+			std::cout << " currmovenumber " << i + 1 << '\n';
 		}
-		else if ((results.nodes_cnt & _check_node_count) == 0 and !limits.isTimeLeft()) {
-			return -Score::undef;
+
+		pos.make(node.move, node.state);
+
+		// child probes the hash table right at the entry, fetch its slot in the meantime
+		if (depth > 1)
+			_tt.prefetch(pos.getZobristKey());
+
+		_eval.prefetch(pos);
+
+		if (i == 0)
+			node.score = -negaMax<PV_NODE>(pos, limits, results, -beta, -alpha, depth - 1, 1);
+		else {
+			node.score = -negaMax<NON_PV_NODE>(pos, limits, results, -alpha - 1, -alpha, depth - 1, 1);
+
+			if (node.score.isValid() and node.score > alpha and node.score < beta)
+				node.score = -negaMax<PV_NODE>(pos, limits, results, -beta, -alpha, depth - 1, 1);
+		}
+
+		pos.unmake(node.move, node.state);
+
+		if (!node.score.isValid())
+			return Score::undef;
+
+		root_move.nodes = results.nodes_cnt - nodes_before;
+
+		// fail-low scores are only upper bounds, so such moves are ordered by subtree size only
+		root_move.score = i == 0 or node.score > alpha ? node.score : Score(-Score::infinity);
+
+		if (node.score > node.best_score) {
+			node.best_move = node.move;
+			node.best_score = node.score;
+
+			if (node.score > alpha) {
+				if (node.score >= beta) {
+					bound_type = TTEntry::UPPERBOUND;
+					break;
+				}
+
+				bound_type = TTEntry::EXACT;
+				alpha = node.score;
+			}
 		}
-		else if (!depth) {
-			return quiesce(pos, limits, results, alpha, beta, ply);
+	}
+
+	_tt.write(pos.getZobristKey(), depth, 0, bound_type, node.best_score, node.best_move, results);
+
+	_tree.getNode(1).move_picker.setKillerMove(Move::null);
+
+	results.score_cp = node.best_score;
+	return node.best_score;
+}
+
+template <Search::enumNode NodeType, bool NullMove>
+Score Search::negaMax(Position& pos, SearchLimits& limits, SearchResults& results, 
+	Score alpha, Score beta, unsigned depth, unsigned ply) {
+	_key_stack[_root_key_idx + ply] = pos.getZobristKey();
+
+	if (pos.halfmoveClock() >= 100 or pos.isInsufficientMaterial() or isRepetition(pos, ply)) {
+		return Score::draw;
+	}
+	else if ((results.nodes_cnt & _check_node_count) == 0 and limits.isStopped(results.prev_nodes + results.nodes_cnt)) {
+		return -Score::undef;
+	}
+
+	// side to move can force a repetition with a single reversible move
+	if (alpha < Score::draw and isUpcomingRepetition(pos, ply)) {
+		alpha = Score::draw;
+
+		if (alpha >= beta) {
+			return alpha;
 		}
 	}
 
+	if (!depth) {
+		return quiesce(pos, limits, results, alpha, beta, ply);
+	}
+
+	// mate distance pruning: even mating right in the next move
+	// can't be better than a shorter mate found somewhere else
+	alpha = std::max(alpha, Score(-Score::infinity + ply));
+	beta = std::min(beta, Score(Score::infinity - ply - 1));
+
+	if (alpha >= beta) {
+		return alpha;
+	}
+
 	TTEntry tt_entry;
 	const bool tt_hit = _tt.probe(tt_entry, pos.getZobristKey(), alpha, beta, depth, ply);
 
-	if (!Root and tt_hit) {
+	if (tt_hit) {
 		return tt_entry.score;
 	}
 
-	results.nodes_cnt++;
+	// Tablebase probe, only right after a zeroing move - tables know nothing about 50-move rule counter.
+	// Probes of positions with the most pieces are the slowest ones and they are limited by depth.
+	const int pieces_cnt = pos.getOccupied().popCount();
+
+	if (pieces_cnt <= _tb_cardinality and (pieces_cnt < _tb_cardinality or depth >= _tb_probe_depth)
+		and !pos.halfmoveClock() and Syzygy::isProbeable(pos)) {
+		Syzygy::ProbeState state;
+		const Syzygy::WDLScore wdl = Syzygy::probeWdl(pos, state);
+
+		if (state != Syzygy::FAIL) {
+			results.tb_hits++;
+
+			// cursed wins and blessed losses are scored just above and below a draw
+			const Score tb_score = wdl == Syzygy::WIN ? Score(_tb_win - static_cast<int16_t>(ply))
+								 : wdl == Syzygy::LOSS ? Score(-_tb_win + static_cast<int16_t>(ply))
+								 : Score(static_cast<int16_t>(wdl));
+			const TTEntry::Bound tb_bound = wdl == Syzygy::WIN ? TTEntry::UPPERBOUND
+										  : wdl == Syzygy::LOSS ? TTEntry::LOWERBOUND : TTEntry::EXACT;
+
+			if (tb_bound == TTEntry::EXACT or (tb_bound == TTEntry::UPPERBOUND ? tb_score >= beta : tb_score <= alpha)) {
+				_tt.write(pos.getZobristKey(), std::min(depth + 6, max_depth - 1), ply, tb_bound, tb_score, Move::null, results);
+				return tb_score;
+			}
+		}
+	}
+
+	const uint64_t nodes_before = results.nodes_cnt++;
 
 	NodeInfo& node = _tree.getNode(ply);
 
 	node.check = pos.isInCheck(pos.getTurn());
 
+	// refutation of the null move, i.e. what the opponent threatens to do
+	Move threat_move = Move::null;
+
 	if constexpr (NullMove) {
-		static constexpr int R = 2;
+		const Score static_eval = !node.check and depth >= 2 and beta < Score::infinity - static_cast<int16_t>(max_depth) ?
+								  _eval.staticEval(pos) : Score(-Score::infinity);
+
+		if (static_eval >= beta) {
+			// reduction grows both with depth and with the margin above beta
+			const unsigned R = 2 + depth / 4 + std::min((static_eval - beta).toInt() / 200, 2),
+						   null_depth = depth > R ? depth - R - 1 : 0;
+			const uint64_t null_nodes_before = results.nodes_cnt;
+
+			results.null_tries++;
+			_tree.getNode(ply + 1).best_move = Move::null;
 
-		if (!node.check and depth >= R + 1) {
 			pos.makeNull(node.state);
-			const Score score =
-				-negaMax<false, NON_PV_NODE, false>(pos, limits, results, game, -beta, -beta + 1, depth - R - 1, ply + 1);
+
+			if (null_depth)
+				_tt.prefetch(pos.getZobristKey());
+
+			Score score =
+				-negaMax<NON_PV_NODE, false>(pos, limits, results, -beta, -beta + 1, null_depth, ply + 1);
 			pos.unmakeNull(node.state);
 
+			if (!score.isValid())
+				return -Score::undef;
+
 			if (score >= beta) {
-				const Score verify = 
-					negaMax<false, NON_PV_NODE, false>(pos, limits, results, game, beta - 1, beta, depth - R - 1, ply);
+				// do not trust mate scores proven after passing a move
+				if (score > Score::infinity - static_cast<int16_t>(max_depth))
+					score = beta;
+
+				// verify the cutoff only in deep nodes and in pawn endings, where zugzwang is likely
+				if (depth >= _null_verify_depth or !pos.hasNonPawnMaterial(pos.getTurn())) {
+					const Score verify = 
+						negaMax<NON_PV_NODE, false>(pos, limits, results, beta - 1, beta, null_depth, ply);
+
+					// not negated, so an interrupted search shows up as -undef
+					if (!(-verify).isValid())
+						return -Score::undef;
+					else if (verify < beta)
+						score = -Score::infinity;
+				}
 
-				if (verify >= beta)
-					return verify;
+				if (score >= beta) {
+					results.registerNullCutoff(_collect_stats ? nullSavedNodes(depth, results.nodes_cnt - null_nodes_before) : 0);
+					return score;
+				}
 			}
+			else
+				threat_move = _tree.getNode(ply + 1).best_move;
 		}
 	}
 
-
 	ASSERT(0 < depth and depth < max_depth, "Depth overflow");
 	assert(alpha < beta);
 
-	const Move tt_move = tt_entry.key == pos.getZobristKey() 
-						 and tt_entry.move.isPseudoLegal(pos) ? tt_entry.move : Move::null;
+	Move tt_move = tt_entry.key == pos.getZobristKey() 
+				   and tt_entry.move.isPseudoLegal(pos) ? tt_entry.move : Move::null;
+
+	// No hash move to start with. In PV nodes find one with reduced depth search (IID),
+	// in the rest of nodes just reduce the depth, as poorly ordered search is expensive anyway (IIR).
+	if (tt_move.isNull()) {
+		if (NodeType == PV_NODE and depth >= _iid_depth) {
+			// IID may return before any move is searched, the node would keep a move of another position
+			node.best_move = Move::null;
+
+			const Score iid_score =
+				negaMax<PV_NODE, false>(pos, limits, results, alpha, beta, depth - 2, ply);
+
+			// not negated, so an interrupted search shows up as -undef
+			if (!(-iid_score).isValid())
+				return -Score::undef;
+
+			tt_move = node.best_move;
+		}
+		else if (NodeType == NON_PV_NODE and depth >= _iir_depth)
+			depth--;
+	}
 
 	node.move_picker.clear();
 	node.move_picker.setHashMove(tt_move);
+	node.move_picker.setThreatMove(threat_move);
 
 	node.can_move = false;
 	node.score = 0;
@@ -168,25 +454,31 @@ Score Search::negaMax(Position& pos, SearchLimits& limits, SearchResults& result
 	TTEntry::Bound bound_type = TTEntry::LOWERBOUND;
 
 	while (node.move_picker.nextMove(_tree, node, pos, node.move)) {
-		bool legal_move = false,
-			 do_search = true;
+		bool legal_move = false;
 
 		if (pos.make(node.move, node.state)) {
 			legal_move = true;
-			node.can_move = true;
 
-			// Principle variation search
-			if (!tt_move.isNull() and node.move != tt_move and NodeType == PV_NODE) {
-				node.score = 
-					-negaMax<false, PV_NODE, true>(pos, limits, results, game, -alpha - 1, -alpha, depth - 1, ply + 1);
+			if (depth > 1)
+				_tt.prefetch(pos.getZobristKey());
 
-				if (node.score <= alpha)
-					do_search = false;
-			} 
+			_eval.prefetch(pos);
 
-			if (do_search)
+			// Principal variation search: only the first legal move is searched with full window.
+			// The rest is probed with null window and re-searched only if it lands inside (alpha, beta).
+			if (!node.can_move)
 				node.score =
-					-negaMax<false, NodeType, true>(pos, limits, results, game, -beta, -alpha, depth - 1, ply + 1);
+					-negaMax<NodeType>(pos, limits, results, -beta, -alpha, depth - 1, ply + 1);
+			else {
+				node.score = 
+					-negaMax<NON_PV_NODE>(pos, limits, results, -alpha - 1, -alpha, depth - 1, ply + 1);
+
+				if (NodeType == PV_NODE and node.score.isValid() and node.score > alpha and node.score < beta)
+					node.score =
+						-negaMax<PV_NODE>(pos, limits, results, -beta, -alpha, depth - 1, ply + 1);
+			}
+
+			node.can_move = true;
 		}
 
 		pos.unmake(node.move, node.state);
@@ -200,8 +492,7 @@ Score Search::negaMax(Position& pos, SearchLimits& limits, SearchResults& result
 					bound_type = TTEntry::UPPERBOUND;
 					if (node.move.isQuiet() and (!node.move.isPromotion() or node.move.getPromoPieceT() != Piece::QUEEN)) {
 						node.move_picker.setKillerMove(node.move);
-						if constexpr (!Root)
-							node.move_picker.setCounterMove(_tree.getNode(ply - 1).move, node.move, !pos.getTurn());
+						_tree.setCounterMove(!pos.getTurn(), _tree.getNode(ply - 1).move, node.move);
 					}
 					break;
 				}
@@ -211,10 +502,6 @@ Score Search::negaMax(Position& pos, SearchLimits& limits, SearchResults& result
 			}
 		}
 		else if (!node.score.isValid()) {
-			if (Root and node.best_move.isNull())
-				// TODO: move at root assigned here might be illegal.
-				node.best_move = node.move;
-
 			return -Score::undef;
 		}
 	}
@@ -229,20 +516,19 @@ Score Search::negaMax(Position& pos, SearchLimits& limits, SearchResults& result
 
 	_tree.getNode(ply + 1).move_picker.setKillerMove(Move::null);
 
-	if constexpr (Root) {
-		results.score_cp = node.best_score;
-	}
+	if (_collect_stats)
+		registerSubtree(depth, results.nodes_cnt - nodes_before);
 
 	return node.best_score;
 }
 
-template Score Search::negaMax<true>(Position& pos, SearchLimits& limits, SearchResults& results, const Game& game,
+template Score Search::negaMax<Search::PV_NODE>(Position& pos, SearchLimits& limits, SearchResults& results,
 	Score alpha, Score beta, unsigned depth, unsigned ply);
-template Score Search::negaMax<false>(Position& pos, SearchLimits& limits, SearchResults& results, const Game& game,
+template Score Search::negaMax<Search::NON_PV_NODE>(Position& pos, SearchLimits& limits, SearchResults& results,
 	Score alpha, Score beta, unsigned depth, unsigned ply);
 
 Score Search::quiesce(Position& pos, SearchLimits& limits, SearchResults& results, Score alpha, Score beta, unsigned ply) {
-	if ((results.nodes_cnt & _check_node_count) == 0 and !limits.isTimeLeft()) {
+	if ((results.nodes_cnt & _check_node_count) == 0 and limits.isStopped(results.prev_nodes + results.nodes_cnt)) {
 		return -Score::undef;
 	}
 
@@ -269,6 +555,7 @@ Score Search::quiesce(Position& pos, SearchLimits& limits, SearchResults& result
 			
 		if (pos.make(move, state)) {
 			legal_move = true;
+			_eval.prefetch(pos);
 			score = -quiesce(pos, limits, results, -beta, -alpha, ply + 1);
 		}
 
@@ -285,43 +572,62 @@ Score Search::quiesce(Position& pos, SearchLimits& limits, SearchResults& result
 	return alpha;
 }
 
-bool Search::isRepetitionCycle(const Position& pos, const Game& game, int ply) {
-	const int my_ply = ply;
-	const uint64_t my_hashkey = pos.getZobristKey();
+bool Search::isRepetition(const Position& pos, unsigned ply) const {
+	const int idx = static_cast<int>(_root_key_idx + ply),
+			  end = std::min(pos.repetitionPlies(), idx);
+	const uint64_t key = _key_stack[idx];
+
+	// position can repeat at least 4 plies back, with the same side to move
+	for (int i = 4; i <= end; i += 2) {
+		if (_key_stack[idx - i] == key)
+			return true;
+	}
 
-	for (ply = ply - 1; ply >= 0; ply--) {
-		const Move move = _tree.getNode(ply).move;
+	return false;
+}
 
-		if (move.isCapture() or move.getPerformerT() == Piece::PAWN)
-			return false;
-		else if ((my_ply - ply) % 2 == 1)
-			continue;
+bool Search::hasRepeated(const Position& pos) const {
+	const int end = std::min<int>(pos.halfmoveClock(), _root_key_idx);
 
-		const uint64_t prev_hashkey = _tree.getNode(ply).state.hash_key;
-		if (my_hashkey == prev_hashkey)
-			return true;
+	for (int idx = _root_key_idx; idx >= static_cast<int>(_root_key_idx) - end + 4; idx--) {
+		for (int i = 4; idx - i >= static_cast<int>(_root_key_idx) - end; i += 2) {
+			if (_key_stack[idx - i] == _key_stack[idx])
+				return true;
+		}
 	}
 
-	const int my_cnt = static_cast<int>(game.currentHalfCount());
+	return false;
+}
+
+bool Search::isUpcomingRepetition(const Position& pos, unsigned ply) const {
+	const int idx = static_cast<int>(_root_key_idx + ply),
+			  end = std::min(pos.repetitionPlies(), idx);
+
+	if (end < 3)
+		return false;
+
+	const uint64_t key = _key_stack[idx];
+	const BitBoard occupied = pos.getOccupied();
 
-	// iterate through only a subset of all game moves
-	for (int i = 1; i <= 11; i++) {
-		const int cnt = my_cnt - i;
+	for (int i = 3; i <= end; i += 2) {
+		const CuckooTables::Entry* move = cuckoo_tables.find(key ^ _key_stack[idx - i]);
 
-		if (cnt < 0) 
-			return false;
+		if (!move)
+			continue;
 
-		const Move move = game.getPrevMove(cnt);
+		const BitBoard path = move->piece_t == Piece::KNIGHT ? BitBoard(BitBoard::empty) 
+							: inBetween(move->org, move->dst) & ~BitBoard(move->org) & ~BitBoard(move->dst);
 
-		if (move.isCapture() or move.getPerformerT() == Piece::PAWN)
-			return false;
-		else if ((my_cnt - cnt) % 2 == 0)
+		if (path & occupied)
 			continue;
 
-		const uint64_t prev_hashkey = game.getPrevKey(cnt);
-		if (my_hashkey == prev_hashkey)
+		// inside the tree any side may go for the repetition. Before the root the move 
+		// has to be made by the side to move, as the opponent could simply avoid it.
+		const Square sq = occupied.isEmptySq(move->org) ? move->dst : move->org;
+
+		if (static_cast<int>(ply) > i or pos.getOwnPieces().isOccupiedSq(sq))
 			return true;
 	}
 
 	return false;
-}
\ No newline at end of file
+}
@@ -4,41 +4,72 @@
 #include "Position.hpp"
 #include "Move.hpp"
 #include "MoveOrder.hpp"
+#include "RootMoveList.hpp"
 #include "Eval.hpp"
 #include "Game.hpp"
 #include "Time.hpp"
 #include "Score.hpp"
 
 #include <numeric>
+#include <vector>
 
 struct SearchLimits {
 	bool isTimeLeft();
+	// time is over or given number of nodes has been searched
+	bool isStopped(uint64_t nodes_cnt);
 
 	unsigned depth = 0,
+			 mate  = 0,
 			 wtime = 0, 
 			 btime = 0, 
 			 winc  = 0, 
 			 binc  = 0,
+			 movetime = 0,
 			 search_time = 0;
+	// nodes of all the iterations, zero means no limit
+	uint64_t nodes = 0;
+	MoveList search_moves;
 	Timer    timer;
 };
 
 class Search;
 
 struct SearchResults {
+	// state after a completed iteration, time and nodes counted from the start of the search
+	struct Iteration {
+		Move	 best_move;
+		Score	 score;
+		int64_t  time;
+		uint64_t nodes;
+	};
+
 	void registerBestMove(Move move);
+	void registerNullCutoff(uint64_t saved_nodes);
 
 	void printBestMove();
-	void print(const Search* search, const Position& pos);
+	void printStats() const;
+	void print();
 
 	unsigned depth      = 0,
 			 seldepth   = 0;
 	Score	 score_cp   = 0;
-	uint64_t nodes_cnt  = 0;
+	uint64_t nodes_cnt  = 0,
+			 prev_nodes = 0;
 	size_t   tt_hits    = 0,
 			 tt_entries = 0;
+	// tablebase probes of the whole search
+	uint64_t tb_hits    = 0;
 	Move     best_move  = Move::null;
+	// principal variation of the last completed iteration
+	MoveList pv;
+	// completed iterations, iterations[d - 1] is the one of depth d
+	std::vector<Iteration> iterations;
 	Timer    timer;
+
+	// null move pruning statistics, saved nodes are counted only when the search collects statistics
+	uint64_t null_tries       = 0,
+			 null_cutoffs     = 0,
+			 null_saved_nodes = 0;
 };
 
 struct NodeInfo {
@@ -58,8 +89,14 @@ public:
 	NodeInfo& getNode(unsigned ply);
 	const NodeInfo& getNode(unsigned ply) const;
 	void clear();
+
+	// quiet move which has refuted the previous move of the opponent, kept through the whole game
+	Move getCounterMove(bool side, Move prev) const;
+	void setCounterMove(bool side, Move prev, Move curr);
+	void clearCounterMoves();
 private:
 	std::array<NodeInfo, max_depth> _node;
+	Move _countermove[2][6][64] = {};
 };
 
 class Eval;
@@ -67,8 +104,6 @@ class TranspositionTable;
 
 class Search {
 public:
-	friend struct SearchResults;
-
 	enum enumNode {
 		PV_NODE,
 		NON_PV_NODE,
@@ -76,28 +111,93 @@ public:
 
 	Search(TranspositionTable& tt);
 
-	void bestMove(Position& pos, const Game& game, SearchLimits limits);
+	// returns number of nodes searched in all the iterations
+	uint64_t bestMove(Position& pos, const Game& game, SearchLimits limits);
 
 	INLINE TranspositionTable& getTranspositionTable() { return _tt; }
+	INLINE Eval& getEval() { return _eval; }
+
+	// results of the last search, depth is the one of its last completed iteration
+	INLINE const SearchResults& getResults() const { return _results; }
+
+	// new game, moves learned in the previous one are forgotten
+	INLINE void clearCounterMoves() { _tree.clearCounterMoves(); }
+
+	// statistics of the last search: null move cutoffs, eval cache and pawn table hits. Debug counters,
+	// so they are printed by bench only, not after every go.
+	void printStats() const;
+
+	// estimate of nodes saved by null move cutoffs costs an update in every node, so it's made only when asked for
+	INLINE void setCollectStats(bool collect_stats) { _collect_stats = collect_stats; }
+
+	// info lines and best move are printed, unless the search runs in the background
+	INLINE void setPrintInfo(bool print_info) { _print_info = print_info; }
+
+	// minimal depth of tablebase probes in nodes with the biggest number of pieces available
+	INLINE void setTablebaseProbeDepth(unsigned depth) { _tb_probe_depth = depth; }
 private:
-	void iterativeDeepening(Position& pos, const Game& game, SearchLimits& limits);
-	bool search(Position& pos, const Game& game, SearchLimits& limits, SearchResults& results);
+	uint64_t iterativeDeepening(Position& pos, SearchLimits& limits);
+	bool search(Position& pos, SearchLimits& limits, SearchResults& results);
+	// best move of the root followed by the hash moves, each one checked, as the table may be shared
+	void storePv(Position pos, SearchResults& results);
+
+	Score rootSearch(Position& pos, SearchLimits& limits, SearchResults& results,
+		Score alpha, Score beta, unsigned depth);
 
-	template <bool Root, enumNode NodeType = PV_NODE, bool NullMove = !Root>
-	Score negaMax(Position& pos, SearchLimits& limits, SearchResults& results, const Game& game,
+	template <enumNode NodeType = PV_NODE, bool NullMove = true>
+	Score negaMax(Position& pos, SearchLimits& limits, SearchResults& results,
 		Score alpha, Score beta, unsigned depth, unsigned ply);
 
 	Score quiesce(Position& pos, SearchLimits& limits, SearchResults& results, Score alpha, Score beta, unsigned ply);
 
-	bool isRepetitionCycle(const Position& pos, const Game& game, int ply);
+	bool isRepetition(const Position& pos, unsigned ply) const;
+	bool isUpcomingRepetition(const Position& pos, unsigned ply) const;
+	// some position since the last irreversible move of the game has occurred twice
+	bool hasRepeated(const Position& pos) const;
+
+	void registerSubtree(unsigned depth, uint64_t nodes);
+	// nodes saved by a null move cutoff, estimated by the average size of a full subtree of the same depth
+	uint64_t nullSavedNodes(unsigned depth, uint64_t null_nodes) const;
 
 	TreeInfo _tree;
+	RootMoveList _root_moves;
+	SearchResults _results;
+	bool _print_info = true;
+	bool _collect_stats = false;
+
+	// sizes of fully searched subtrees of the last search by their depth, when statistics are collected
+	std::array<uint64_t, max_depth> _subtree_nodes = {},
+									_subtree_cnt   = {};
+
+	// keys of positions played in the game and then those on the search path
+	std::array<uint64_t, max_game_moves + max_depth> _key_stack;
+	unsigned _root_key_idx = 0;
 	Eval _eval;
 	TranspositionTable& _tt;
+	// maximal number of pieces of positions probed in the search, zero disables probing
+	int _tb_cardinality = 0;
+	unsigned _tb_probe_depth = 1;
 
 	static constexpr uint64_t _check_node_count = 4096;
+	static constexpr unsigned _null_verify_depth = 10;
+	// minimal depths of internal iterative deepening and reductions
+	static constexpr unsigned _iid_depth = 5,
+							  _iir_depth = 4;
+	// currmove info is sent only in longer searches to not flood the GUI
+	static constexpr unsigned _currmove_info_ms = 3000;
+	// tablebase wins are scored below the mate scores
+	static constexpr int16_t _tb_win = Score::infinity - 2 * static_cast<int16_t>(max_depth);
 };
 
+INLINE bool SearchLimits::isTimeLeft() {
+	timer.stop();
+	return !search_time or timer.duration() < search_time;
+}
+
+INLINE bool SearchLimits::isStopped(uint64_t nodes_cnt) {
+	return (nodes and nodes_cnt >= nodes) or !isTimeLeft();
+}
+
 INLINE NodeInfo& TreeInfo::getNode(unsigned ply) {
 	assert(ply < max_depth);
 	return _node[ply];
@@ -111,4 +211,16 @@ INLINE const NodeInfo& TreeInfo::getNode(unsigned ply) const {
 INLINE void TreeInfo::clear() {
 	for (auto& node : _node) 
 		node.move_picker.setKillerMove(Move::null);
+}
+
+INLINE Move TreeInfo::getCounterMove(bool side, Move prev) const {
+	return _countermove[side][prev.getPerformerT()][prev.getTarget()];
+}
+
+INLINE void TreeInfo::setCounterMove(bool side, Move prev, Move curr) {
+	_countermove[side][prev.getPerformerT()][prev.getTarget()] = curr;
+}
+
+INLINE void TreeInfo::clearCounterMoves() {
+	std::fill_n(&_countermove[0][0][0], sizeof(_countermove) / sizeof(Move), Move(Move::null));
 }
\ No newline at end of file
@@ -4,7 +4,7 @@
 
 class Square {
 public:
-	enum enumSquare;
+	enum enumSquare : int;
 
 	Square() = default;
 	INLINE constexpr Square(uint8_t cpy)
@@ -46,12 +46,17 @@ public:
 		else std::cout << "abcdefgh"[_sq % 8] << (_sq / 8 + 1);
 	}
 
+	std::string toStr() const {
+		if (isNull()) return "-";
+		return { "abcdefgh"[_sq % 8], static_cast<char>('1' + _sq / 8) };
+	}
+
 	INLINE constexpr bool isValid() const {
 		return 0 <= _sq and _sq < 64 or _sq == none;
 	}
 
 	// little endian rank-file mapping
-	enum enumSquare {
+	enum enumSquare : int {
 		a1, b1, c1, d1, e1, f1, g1, h1,
 		a2, b2, c2, d2, e2, f2, g2, h2,
 		a3, b3, c3, d3, e3, f3, g3, h3,
@@ -62,7 +67,7 @@ public:
 		a8, b8, c8, d8, e8, f8, g8, h8
 	};
 
-	static constexpr uint8_t none = -1Ui8;
+	static constexpr uint8_t none = 0xff;
 private:
 	uint8_t _sq;
 };
\ No newline at end of file
@@ -0,0 +1,1282 @@
+#include "Syzygy.hpp"
+#include "MoveGen.hpp"
+#include "MappedFile.hpp"
+#include "Hash.hpp"
+
+#include <atomic>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+	using namespace Syzygy;
+
+	enum TableType : uint8_t {
+		WDL, DTZ
+	};
+
+	// flags of a single table, stored in the table file
+	enum TableFlag : uint8_t {
+		STM = 1,
+		MAPPED = 2,
+		WIN_PLIES = 4,
+		LOSS_PLIES = 8,
+		WIDE = 16,
+		SINGLE_VALUE = 128
+	};
+
+	template <typename T>
+	INLINE T byteSwap(T value) {
+		T res = 0;
+
+		for (size_t i = 0; i < sizeof(T); i++, value = static_cast<T>(value >> 8))
+			res = static_cast<T>((res << 8) | (value & 0xff));
+
+		return res;
+	}
+
+	template <typename T>
+	INLINE T readLittleEndian(const void* addr) {
+		T value;
+		std::memcpy(&value, addr, sizeof(T));
+
+		if constexpr (std::endian::native == std::endian::big)
+			value = byteSwap(value);
+
+		return value;
+	}
+
+	template <typename T>
+	INLINE T readBigEndian(const void* addr) {
+		T value;
+		std::memcpy(&value, addr, sizeof(T));
+
+		if constexpr (std::endian::native == std::endian::little)
+			value = byteSwap(value);
+
+		return value;
+	}
+
+	// piece codes used by table files: white pieces 1..6, black ones 9..14
+	INLINE int tablePiece(enumColor col, Piece::enumType piece_t) {
+		return piece_t + 1 + 8 * (col == BLACK);
+	}
+
+	INLINE int squareFile(int sq) { return sq & 7; }
+	INLINE int squareRank(int sq) { return sq >> 3; }
+
+	// signed distance from a1-h8 diagonal, positive above it
+	INLINE int offA1H8(int sq) { return squareRank(sq) - squareFile(sq); }
+
+	/*
+		Index encoding tables. The first piece is mapped to a1-d1-d4 triangle with symmetries,
+		kings are encoded together in 462 legal placements, pawns use only 48 squares.
+	*/
+	struct EncodingTables {
+		EncodingTables();
+
+		std::array<int, 64> map_pawns = {},
+							map_b1h1h7 = {},
+							map_a1d1d4 = {};
+		std::array<std::array<int, 64>, 10> map_kk = {};
+		std::array<std::array<int, 64>, 6> binomial = {},
+										   lead_pawn_idx = {};
+		std::array<std::array<int, 4>, 6> lead_pawns_size = {};
+	};
+
+	EncodingTables::EncodingTables() {
+		int code = 0;
+
+		for (int sq = 0; sq < 64; sq++) {
+			if (offA1H8(sq) < 0)
+				map_b1h1h7[sq] = code++;
+		}
+
+		std::vector<int> diagonal;
+		code = 0;
+
+		for (int sq : { 0, 1, 2, 3, 8, 9, 10, 11, 16, 17, 18, 19, 24, 25, 26, 27 }) {
+			if (offA1H8(sq) < 0)
+				map_a1d1d4[sq] = code++;
+			else if (!offA1H8(sq))
+				diagonal.push_back(sq);
+		}
+
+		// diagonal squares are encoded as the last ones
+		for (int sq : diagonal)
+			map_a1d1d4[sq] = code++;
+
+		// all the legal placements of two kings, when the first one is on a1-d4 diagonal
+		// the second one can't be above a1-h8 diagonal
+		std::vector<std::pair<int, int>> both_on_diagonal;
+		code = 0;
+
+		for (int idx = 0; idx < 10; idx++) {
+			for (int sq1 = 0; sq1 <= 27; sq1++) {
+				// b1 is mapped to 0 as well as a1
+				if (map_a1d1d4[sq1] != idx or (!idx and sq1 != 1))
+					continue;
+
+				for (int sq2 = 0; sq2 < 64; sq2++) {
+					const bool adjacent = std::abs(squareFile(sq1) - squareFile(sq2)) <= 1
+						and std::abs(squareRank(sq1) - squareRank(sq2)) <= 1;
+
+					if (adjacent)
+						continue;
+					else if (!offA1H8(sq1) and offA1H8(sq2) > 0)
+						continue;
+					else if (!offA1H8(sq1) and !offA1H8(sq2))
+						both_on_diagonal.emplace_back(idx, sq2);
+					else
+						map_kk[idx][sq2] = code++;
+				}
+			}
+		}
+
+		for (const auto& [idx, sq] : both_on_diagonal)
+			map_kk[idx][sq] = code++;
+
+		// binomial[k][n] ways to choose k squares out of n
+		binomial[0][0] = 1;
+
+		for (int n = 1; n < 64; n++) {
+			for (int k = 0; k < 6 and k <= n; k++)
+				binomial[k][n] = (k > 0 ? binomial[k - 1][n - 1] : 0) + (k < n ? binomial[k][n - 1] : 0);
+		}
+
+		// map_pawns[sq] is number of squares left for other pawns when the leading one is on sq:
+		// the leading pawn is the one nearest the edge and, on the same file, the one with lowest rank
+		int available = 47;
+
+		for (int lead_cnt = 1; lead_cnt <= 5; lead_cnt++) {
+			for (int file = 0; file < 4; file++) {
+				int idx = 0;
+
+				for (int rank = 1; rank <= 6; rank++) {
+					const int sq = 8 * rank + file;
+
+					if (lead_cnt == 1) {
+						map_pawns[sq] = available--;
+						map_pawns[sq ^ 7] = available--;
+					}
+
+					lead_pawn_idx[lead_cnt][sq] = idx;
+					idx += binomial[lead_cnt - 1][map_pawns[sq]];
+				}
+
+				lead_pawns_size[lead_cnt][file] = idx;
+			}
+		}
+	}
+
+	const EncodingTables encoding;
+
+	using Sym = uint16_t;
+
+	// symbol pair of the recursive pairing tree, 12 bits each
+	struct LR {
+		uint8_t lr[3];
+
+		INLINE Sym left() const { return static_cast<Sym>(((lr[1] & 0xf) << 8) | lr[0]); }
+		INLINE Sym right() const { return static_cast<Sym>((lr[2] << 4) | (lr[1] >> 4)); }
+	};
+
+	static_assert(sizeof(LR) == 3);
+
+	struct SparseEntry {
+		uint8_t block[4];
+		uint8_t offset[2];
+	};
+
+	static_assert(sizeof(SparseEntry) == 6);
+
+	// compressed data of a table for one side to move and one file of the leading pawn
+	struct PairsData {
+		uint8_t flags;
+		uint8_t max_sym_len, min_sym_len;
+		uint32_t blocks_count;
+		size_t block_size;
+		// there is a sparse index entry every span values
+		size_t span;
+		const Sym* lowest_sym;
+		const LR* btree;
+		const uint8_t* block_length;
+		uint32_t block_length_size;
+		const SparseEntry* sparse_index;
+		size_t sparse_index_size;
+		const uint8_t* data;
+		std::vector<uint64_t> base64;
+		std::vector<uint8_t> sym_len;
+		std::array<int, max_pieces> pieces;
+		std::array<uint64_t, max_pieces + 1> group_idx;
+		std::array<int, max_pieces + 1> group_len;
+		// DTZ value maps offsets, indexed by WDL result
+		std::array<uint16_t, 4> map_idx;
+	};
+
+	template <TableType Type>
+	struct Table {
+		using Ret = std::conditional_t<Type == WDL, WDLScore, int>;
+
+		static constexpr int sides = Type == WDL ? 2 : 1;
+
+		Table() = default;
+		Table(const std::string& code);
+		Table(const Table<WDL>& wdl);
+
+		INLINE PairsData* get(int stm, int file) {
+			return &items[stm % sides][has_pawns ? file : 0];
+		}
+
+		std::atomic<bool> ready = false;
+		MappedFile file;
+		const uint8_t* map = nullptr;
+		// material keys of the table, with the first side white and black
+		uint64_t key = 0, key2 = 0;
+		int piece_count = 0;
+		bool has_pawns = false,
+			 has_unique_pieces = false;
+		// pawns of the leading color and of the other one
+		std::array<uint8_t, 2> pawn_count = {};
+		PairsData items[sides][4] = {};
+	};
+
+	// material key of given piece counts, the same as the key of a position with these pieces
+	uint64_t materialKey(const std::array<std::array<int, 6>, 2>& counts) {
+		uint64_t key = 0;
+
+		for (enumColor col : { WHITE, BLACK }) {
+			for (auto piece_t : Piece::piece_list) {
+				for (int i = 0; i < counts[col][piece_t]; i++)
+					key ^= zobrist_keys.piece[col][piece_t][i];
+			}
+		}
+
+		return key;
+	}
+
+	// code is like KRPvKR
+	template <>
+	Table<WDL>::Table(const std::string& code) {
+		std::array<std::array<int, 6>, 2> counts = {};
+		int side = 0;
+
+		for (char c : code) {
+			if (c == 'v')
+				side = 1;
+			else
+				counts[side][Piece::typeFromChar(c)]++;
+		}
+
+		for (int s = 0; s < 2; s++) {
+			for (int piece_t = 0; piece_t < 6; piece_t++) {
+				piece_count += counts[s][piece_t];
+
+				if (piece_t != Piece::KING and counts[s][piece_t] == 1)
+					has_unique_pieces = true;
+			}
+		}
+
+		has_pawns = counts[0][Piece::PAWN] or counts[1][Piece::PAWN];
+
+		// leading color is the one with less pawns, as it compresses better
+		const bool first_leads = !counts[1][Piece::PAWN]
+			or (counts[0][Piece::PAWN] and counts[1][Piece::PAWN] >= counts[0][Piece::PAWN]);
+
+		pawn_count[0] = static_cast<uint8_t>(counts[!first_leads][Piece::PAWN]);
+		pawn_count[1] = static_cast<uint8_t>(counts[first_leads][Piece::PAWN]);
+
+		key = materialKey(counts);
+		std::swap(counts[0], counts[1]);
+		key2 = materialKey(counts);
+	}
+
+	template <>
+	Table<DTZ>::Table(const Table<WDL>& wdl) {
+		key = wdl.key;
+		key2 = wdl.key2;
+		piece_count = wdl.piece_count;
+		has_pawns = wdl.has_pawns;
+		has_unique_pieces = wdl.has_unique_pieces;
+		pawn_count = wdl.pawn_count;
+	}
+
+	/*
+		All the tables found, in a small open addressing hash table indexed by material key.
+		Every table is registered twice, for both colors of its first side.
+	*/
+	class Tables {
+	public:
+		struct Entry {
+			uint64_t key;
+			Table<WDL>* wdl;
+			Table<DTZ>* dtz;
+
+			template <TableType Type>
+			INLINE Table<Type>* get() const {
+				if constexpr (Type == WDL)
+					return wdl;
+				else
+					return dtz;
+			}
+		};
+
+		template <TableType Type>
+		Table<Type>* get(uint64_t key) {
+			for (const Entry* entry = &_hash_table[key & (size - 1)]; ; entry++) {
+				if (entry->key == key or !entry->get<Type>())
+					return entry->get<Type>();
+			}
+		}
+
+		void clear();
+		void add(const std::vector<Piece::enumType>& pieces);
+
+		INLINE size_t count() const { return _wdl_tables.size(); }
+
+		std::vector<std::string> paths;
+		int max_cardinality = 0;
+	private:
+		void insert(uint64_t key, Table<WDL>* wdl, Table<DTZ>* dtz);
+
+		static constexpr size_t size = 1 << 12,
+								overflow = 1;
+
+		std::array<Entry, size + overflow> _hash_table = {};
+		std::deque<Table<WDL>> _wdl_tables;
+		std::deque<Table<DTZ>> _dtz_tables;
+	};
+
+	void Tables::clear() {
+		_hash_table.fill(Entry{});
+		_wdl_tables.clear();
+		_dtz_tables.clear();
+		max_cardinality = 0;
+	}
+
+	void Tables::insert(uint64_t key, Table<WDL>* wdl, Table<DTZ>* dtz) {
+		size_t home = key & (size - 1);
+		Entry entry{ key, wdl, dtz };
+
+		// last entry stays empty, so lookups always stop
+		for (size_t bucket = home; bucket < size + overflow - 1; bucket++) {
+			const uint64_t other_key = _hash_table[bucket].key;
+
+			if (other_key == key or !_hash_table[bucket].wdl) {
+				_hash_table[bucket] = entry;
+				return;
+			}
+
+			// Robin Hood hashing: the entry which is further from its home bucket stays
+			const size_t other_home = other_key & (size - 1);
+
+			if (other_home > home) {
+				std::swap(entry, _hash_table[bucket]);
+				key = other_key;
+				home = other_home;
+			}
+		}
+
+		ASSERT(false, "Tablebase hash table is too small");
+	}
+
+	Tables tables;
+
+	bool fileExists(const std::string& name) {
+		for (const auto& dir : tables.paths) {
+			if (std::ifstream(dir + '/' + name).is_open())
+				return true;
+		}
+
+		return false;
+	}
+
+	void Tables::add(const std::vector<Piece::enumType>& pieces) {
+		std::string code;
+
+		for (auto piece_t : pieces)
+			code += "PNBRQK"[piece_t];
+
+		// KRK -> KRvK
+		code.insert(code.find('K', 1), "v");
+
+		if (!fileExists(code + ".rtbw"))
+			return;
+
+		max_cardinality = std::max(static_cast<int>(pieces.size()), max_cardinality);
+
+		_wdl_tables.emplace_back(code);
+		_dtz_tables.emplace_back(_wdl_tables.back());
+
+		insert(_wdl_tables.back().key, &_wdl_tables.back(), &_dtz_tables.back());
+		insert(_wdl_tables.back().key2, &_wdl_tables.back(), &_dtz_tables.back());
+	}
+
+	/*
+		Decompresses value of index idx. Table values are compressed with recursive pairing,
+		then the symbols are Huffman coded in blocks of fixed size. The sparse index points
+		near the block of the index, block lengths lead to the exact one, and then the symbols
+		are decoded up to the one which expands to our value.
+	*/
+	int decompressPairs(const PairsData* d, uint64_t idx) {
+		if (d->flags & SINGLE_VALUE)
+			return d->min_sym_len;
+
+		const uint32_t k = static_cast<uint32_t>(idx / d->span);
+
+		// the sparse index entry describes value k * span + span / 2
+		uint32_t block = readLittleEndian<uint32_t>(d->sparse_index[k].block);
+		int offset = readLittleEndian<uint16_t>(d->sparse_index[k].offset);
+
+		offset += static_cast<int>(idx % d->span) - static_cast<int>(d->span / 2);
+
+		// block n stores block_length[n] + 1 values
+		while (offset < 0)
+			offset += readLittleEndian<uint16_t>(d->block_length + 2 * --block) + 1;
+
+		while (offset > readLittleEndian<uint16_t>(d->block_length + 2 * block))
+			offset -= readLittleEndian<uint16_t>(d->block_length + 2 * block++) + 1;
+
+		const uint8_t* ptr = d->data + static_cast<uint64_t>(block) * d->block_size;
+
+		// first symbol starts at the beginning of the block
+		uint64_t buf64 = readBigEndian<uint64_t>(ptr);
+		int buf64_size = 64;
+		Sym sym;
+
+		ptr += 8;
+
+		for (;;) {
+			int len = 0;
+
+			// symbols of the same length are consecutive numbers and longer symbols
+			// have lower values, so length is found by comparing with base of each length
+			while (buf64 < d->base64[len])
+				len++;
+
+			sym = static_cast<Sym>((buf64 - d->base64[len]) >> (64 - len - d->min_sym_len));
+			sym = static_cast<Sym>(sym + readLittleEndian<Sym>(d->lowest_sym + len));
+
+			if (offset < d->sym_len[sym] + 1)
+				break;
+
+			offset -= d->sym_len[sym] + 1;
+			len += d->min_sym_len;
+			buf64 <<= len;
+			buf64_size -= len;
+
+			if (buf64_size <= 32) {
+				buf64_size += 32;
+				buf64 |= static_cast<uint64_t>(readBigEndian<uint32_t>(ptr)) << (64 - buf64_size);
+				ptr += 4;
+			}
+		}
+
+		// symbol expands into sym_len[sym] + 1 values, children of a pair are adjacent
+		while (d->sym_len[sym]) {
+			const Sym left = d->btree[sym].left();
+
+			if (offset < d->sym_len[left] + 1)
+				sym = left;
+			else {
+				offset -= d->sym_len[left] + 1;
+				sym = d->btree[sym].right();
+			}
+		}
+
+		return d->btree[sym].left();
+	}
+
+	INLINE bool checkDtzStm(Table<WDL>*, int, int) {
+		return true;
+	}
+
+	// DTZ tables store only one side to move
+	INLINE bool checkDtzStm(Table<DTZ>* entry, int stm, int file) {
+		const uint8_t flags = entry->get(stm, file)->flags;
+		return (flags & STM) == stm or (entry->key == entry->key2 and !entry->has_pawns);
+	}
+
+	INLINE WDLScore mapScore(Table<WDL>*, int, int value, WDLScore) {
+		return static_cast<WDLScore>(value - 2);
+	}
+
+	int mapScore(Table<DTZ>* entry, int file, int value, WDLScore wdl) {
+		static constexpr int wdl_map[] = { 1, 3, 0, 2, 0 };
+
+		const PairsData* d = entry->get(0, file);
+
+		if (d->flags & MAPPED) {
+			const size_t idx = d->map_idx[wdl_map[wdl + 2]] + value;
+
+			value = d->flags & WIDE ? readLittleEndian<uint16_t>(entry->map + 2 * idx) : entry->map[idx];
+		}
+
+		// values are stored in moves or plies, plies are returned
+		if ((wdl == WIN and !(d->flags & WIN_PLIES))
+			or (wdl == LOSS and !(d->flags & LOSS_PLIES))
+			or wdl == CURSED_WIN or wdl == BLESSED_LOSS)
+			value *= 2;
+
+		return value + 1;
+	}
+
+	INLINE bool pawnsCompare(int sq1, int sq2) {
+		return encoding.map_pawns[sq1] < encoding.map_pawns[sq2];
+	}
+
+	// index of the position in the table, then its value
+	template <TableType Type>
+	typename Table<Type>::Ret probeTable(const Position& pos, Table<Type>* entry, WDLScore wdl, ProbeState& state) {
+		using Ret = typename Table<Type>::Ret;
+
+		std::array<int, max_pieces> squares, pieces;
+		int size = 0,
+			lead_pawns_cnt = 0,
+			table_file = 0;
+		BitBoard lead_pawns = 0;
+		uint64_t idx;
+
+		// a table with the same pieces on both sides stores only white to move,
+		// when the stronger side is black, colors and squares are flipped
+		const bool flip = (entry->key == entry->key2 and pos.getTurn() == BLACK) or pos.getMaterialKey() != entry->key;
+		const int flip_color = flip * 8,
+				  flip_squares = flip * 56,
+				  stm = flip ^ (pos.getTurn() == BLACK);
+
+		// tables with pawns are split by file of the leading pawn, the one with the highest map_pawns value
+		if (entry->has_pawns) {
+			const int lead_piece = entry->get(0, 0)->pieces[0] ^ flip_color;
+			const enumColor lead_col = static_cast<enumColor>(lead_piece >> 3);
+
+			BitBoard pawns = lead_pawns = pos.getPawnsBySide(lead_col);
+
+			while (pawns)
+				squares[size++] = pawns.dropForward() ^ flip_squares;
+
+			lead_pawns_cnt = size;
+
+			std::swap(squares[0], *std::max_element(squares.begin(), squares.begin() + lead_pawns_cnt, pawnsCompare));
+
+			table_file = squareFile(squares[0]);
+
+			if (table_file > 3)
+				table_file = squareFile(squares[0] ^ 7);
+		}
+
+		if (!checkDtzStm(entry, stm, table_file)) {
+			state = CHANGE_STM;
+			return Ret();
+		}
+
+		for (enumColor col : { WHITE, BLACK }) {
+			for (auto piece_t : Piece::piece_list) {
+				BitBoard bb = pos.getPiecesBySide(col, piece_t) & ~lead_pawns;
+
+				while (bb) {
+					squares[size] = bb.dropForward() ^ flip_squares;
+					pieces[size++] = tablePiece(col, piece_t) ^ flip_color;
+				}
+			}
+		}
+
+		const PairsData* d = entry->get(stm, table_file);
+
+		// the same piece order as the one of the table
+		for (int i = lead_pawns_cnt; i < size - 1; i++) {
+			for (int j = i + 1; j < size; j++) {
+				if (d->pieces[i] == pieces[j]) {
+					std::swap(pieces[i], pieces[j]);
+					std::swap(squares[i], squares[j]);
+					break;
+				}
+			}
+		}
+
+		// the leading piece goes to a-d files
+		if (squareFile(squares[0]) > 3) {
+			for (int i = 0; i < size; i++)
+				squares[i] ^= 7;
+		}
+
+		if (entry->has_pawns) {
+			idx = encoding.lead_pawn_idx[lead_pawns_cnt][squares[0]];
+
+			std::stable_sort(squares.begin() + 1, squares.begin() + lead_pawns_cnt, pawnsCompare);
+
+			for (int i = 1; i < lead_pawns_cnt; i++)
+				idx += encoding.binomial[i][encoding.map_pawns[squares[i]]];
+		}
+		else {
+			// without pawns the leading piece goes further to 1-4 ranks
+			if (squareRank(squares[0]) > 3) {
+				for (int i = 0; i < size; i++)
+					squares[i] ^= 56;
+			}
+
+			// and below a1-h8 diagonal, the first piece of the leading group not on the diagonal decides
+			for (int i = 0; i < d->group_len[0]; i++) {
+				if (!offA1H8(squares[i]))
+					continue;
+
+				if (offA1H8(squares[i]) > 0) {
+					for (int j = i; j < size; j++)
+						squares[j] = ((squares[j] >> 3) | (squares[j] << 3)) & 63;
+				}
+
+				break;
+			}
+
+			// At least 3 unique pieces (kings included) are encoded together. Squares of the next
+			// pieces are mapped down by the number of squares already taken by the previous ones.
+			if (entry->has_unique_pieces) {
+				const int adjust1 = squares[1] > squares[0],
+						  adjust2 = (squares[2] > squares[0]) + (squares[2] > squares[1]);
+
+				// first piece below the diagonal
+				if (offA1H8(squares[0])) {
+					idx = (encoding.map_a1d1d4[squares[0]] * 63 + (squares[1] - adjust1)) * 62
+						+ squares[2] - adjust2;
+				}
+				// first piece on the diagonal, second below
+				else if (offA1H8(squares[1])) {
+					idx = (6 * 63 + squareRank(squares[0]) * 28 + encoding.map_b1h1h7[squares[1]]) * 62
+						+ squares[2] - adjust2;
+				}
+				// two pieces on the diagonal, third below
+				else if (offA1H8(squares[2])) {
+					idx = 6 * 63 * 62 + 4 * 28 * 62
+						+ squareRank(squares[0]) * 7 * 28
+						+ (squareRank(squares[1]) - adjust1) * 28
+						+ encoding.map_b1h1h7[squares[2]];
+				}
+				// all of them on the diagonal
+				else {
+					idx = 6 * 63 * 62 + 4 * 28 * 62 + 4 * 7 * 28
+						+ squareRank(squares[0]) * 7 * 6
+						+ (squareRank(squares[1]) - adjust1) * 6
+						+ (squareRank(squares[2]) - adjust2);
+				}
+			}
+			// only the kings are encoded together
+			else
+				idx = encoding.map_kk[encoding.map_a1d1d4[squares[0]]][squares[1]];
+		}
+
+		idx *= d->group_idx[0];
+
+		// remaining pawns, then groups of the same pieces, squares in ascending order in each group
+		int* group_sq = squares.data() + d->group_len[0];
+		bool remaining_pawns = entry->has_pawns and entry->pawn_count[1];
+
+		for (int next = 1; d->group_len[next]; next++) {
+			std::stable_sort(group_sq, group_sq + d->group_len[next]);
+			uint64_t n = 0;
+
+			for (int i = 0; i < d->group_len[next]; i++) {
+				const auto adjust = std::count_if(squares.data(), group_sq, [&](int sq) { return group_sq[i] > sq; });
+				n += encoding.binomial[i + 1][group_sq[i] - adjust - 8 * remaining_pawns];
+			}
+
+			remaining_pawns = false;
+			idx += n * d->group_idx[next];
+			group_sq += d->group_len[next];
+		}
+
+		return mapScore(entry, table_file, decompressPairs(d, idx), wdl);
+	}
+
+	// group lengths and index factors of the groups, in the order given by the table
+	template <TableType Type>
+	void setGroups(Table<Type>& e, PairsData* d, const int order[], int file) {
+		int n = 0,
+			first_len = e.has_pawns ? 0 : e.has_unique_pieces ? 3 : 2;
+
+		d->group_len[n] = 1;
+
+		for (int i = 1; i < e.piece_count; i++) {
+			if (--first_len > 0 or d->pieces[i] == d->pieces[i - 1])
+				d->group_len[n]++;
+			else
+				d->group_len[++n] = 1;
+		}
+
+		d->group_len[++n] = 0;
+
+		const bool pawns_on_both_sides = e.has_pawns and e.pawn_count[1];
+		int next = pawns_on_both_sides ? 2 : 1,
+			free_squares = 64 - d->group_len[0] - (pawns_on_both_sides ? d->group_len[1] : 0);
+		uint64_t idx = 1;
+
+		for (int k = 0; next < n or k == order[0] or k == order[1]; k++) {
+			// leading pawns or pieces
+			if (k == order[0]) {
+				d->group_idx[0] = idx;
+				idx *= e.has_pawns ? encoding.lead_pawns_size[d->group_len[0]][file]
+					 : e.has_unique_pieces ? 31332 : 462;
+			}
+			// remaining pawns
+			else if (k == order[1]) {
+				d->group_idx[1] = idx;
+				idx *= encoding.binomial[d->group_len[1]][48 - d->group_len[0]];
+			}
+			// remaining pieces
+			else {
+				d->group_idx[next] = idx;
+				idx *= encoding.binomial[d->group_len[next]][free_squares];
+				free_squares -= d->group_len[next++];
+			}
+		}
+
+		d->group_idx[n] = idx;
+	}
+
+	uint8_t setSymLen(PairsData* d, Sym sym, std::vector<bool>& visited) {
+		visited[sym] = true;
+
+		const Sym right = d->btree[sym].right();
+
+		// leaf symbol
+		if (right == 0xfff)
+			return 0;
+
+		const Sym left = d->btree[sym].left();
+
+		if (!visited[left])
+			d->sym_len[left] = setSymLen(d, left, visited);
+
+		if (!visited[right])
+			d->sym_len[right] = setSymLen(d, right, visited);
+
+		return static_cast<uint8_t>(d->sym_len[left] + d->sym_len[right] + 1);
+	}
+
+	const uint8_t* setSizes(PairsData* d, const uint8_t* data) {
+		d->flags = *data++;
+
+		if (d->flags & SINGLE_VALUE) {
+			d->blocks_count = d->block_length_size = 0;
+			d->span = d->sparse_index_size = 0;
+			// the single value of the table
+			d->min_sym_len = *data++;
+			return data;
+		}
+
+		// the last group index is the size of the table
+		const uint64_t table_size =
+			d->group_idx[std::find(d->group_len.begin(), d->group_len.end(), 0) - d->group_len.begin()];
+
+		d->block_size = size_t(1) << *data++;
+		d->span = size_t(1) << *data++;
+		d->sparse_index_size = static_cast<size_t>((table_size + d->span - 1) / d->span);
+
+		const uint8_t padding = *data++;
+
+		d->blocks_count = readLittleEndian<uint32_t>(data);
+		data += sizeof(uint32_t);
+		// padding ensures the sparse index doesn't point out of range
+		d->block_length_size = d->blocks_count + padding;
+		d->max_sym_len = *data++;
+		d->min_sym_len = *data++;
+		d->lowest_sym = reinterpret_cast<const Sym*>(data);
+		d->base64.resize(d->max_sym_len - d->min_sym_len + 1);
+
+		// Canonical Huffman code: longer symbols have lower values, base64[i] is the lowest value
+		// of symbols of length i + min_sym_len, padded to 64 bits on the right.
+		for (int i = static_cast<int>(d->base64.size()) - 2; i >= 0; i--) {
+			d->base64[i] = (d->base64[i + 1] + readLittleEndian<Sym>(d->lowest_sym + i)
+				- readLittleEndian<Sym>(d->lowest_sym + i + 1)) / 2;
+		}
+
+		for (size_t i = 0; i < d->base64.size(); i++)
+			d->base64[i] <<= 64 - i - d->min_sym_len;
+
+		data += d->base64.size() * sizeof(Sym);
+		d->sym_len.resize(readLittleEndian<uint16_t>(data));
+		data += sizeof(uint16_t);
+		d->btree = reinterpret_cast<const LR*>(data);
+
+		// number of values each symbol expands to, minus one
+		std::vector<bool> visited(d->sym_len.size());
+
+		for (size_t sym = 0; sym < d->sym_len.size(); sym++) {
+			if (!visited[sym])
+				d->sym_len[sym] = setSymLen(d, static_cast<Sym>(sym), visited);
+		}
+
+		return data + d->sym_len.size() * sizeof(LR) + (d->sym_len.size() & 1);
+	}
+
+	INLINE const uint8_t* setDtzMap(Table<WDL>&, const uint8_t* data, int) {
+		return data;
+	}
+
+	const uint8_t* setDtzMap(Table<DTZ>& e, const uint8_t* data, int max_file) {
+		e.map = data;
+
+		for (int file = 0; file <= max_file; file++) {
+			PairsData* d = e.get(0, file);
+
+			if (!(d->flags & MAPPED))
+				continue;
+
+			if (d->flags & WIDE) {
+				// word alignment
+				data += reinterpret_cast<uintptr_t>(data) & 1;
+
+				for (int i = 0; i < 4; i++) {
+					d->map_idx[i] = static_cast<uint16_t>((data - e.map) / 2 + 1);
+					data += 2 * readLittleEndian<uint16_t>(data) + 2;
+				}
+			}
+			else {
+				for (int i = 0; i < 4; i++) {
+					d->map_idx[i] = static_cast<uint16_t>(data - e.map + 1);
+					data += *data + 1;
+				}
+			}
+		}
+
+		return data + (reinterpret_cast<uintptr_t>(data) & 1);
+	}
+
+	// reads layout of the table file, data starts after the magic number
+	template <TableType Type>
+	void setup(Table<Type>& e, const uint8_t* data) {
+		data++;
+
+		const int sides = Table<Type>::sides == 2 and e.key != e.key2 ? 2 : 1,
+				  max_file = e.has_pawns ? 3 : 0;
+		const bool pawns_on_both_sides = e.has_pawns and e.pawn_count[1];
+
+		for (int file = 0; file <= max_file; file++) {
+			for (int i = 0; i < sides; i++)
+				*e.get(i, file) = PairsData();
+
+			const int order[2][2] = {
+				{ *data & 0xf, pawns_on_both_sides ? *(data + 1) & 0xf : 0xf },
+				{ *data >> 4, pawns_on_both_sides ? *(data + 1) >> 4 : 0xf }
+			};
+
+			data += 1 + pawns_on_both_sides;
+
+			for (int k = 0; k < e.piece_count; k++, data++) {
+				for (int i = 0; i < sides; i++)
+					e.get(i, file)->pieces[k] = i ? *data >> 4 : *data & 0xf;
+			}
+
+			for (int i = 0; i < sides; i++)
+				setGroups(e, e.get(i, file), order[i], file);
+		}
+
+		data += reinterpret_cast<uintptr_t>(data) & 1;
+
+		for (int file = 0; file <= max_file; file++) {
+			for (int i = 0; i < sides; i++)
+				data = setSizes(e.get(i, file), data);
+		}
+
+		data = setDtzMap(e, data, max_file);
+
+		for (int file = 0; file <= max_file; file++) {
+			for (int i = 0; i < sides; i++) {
+				PairsData* d = e.get(i, file);
+				d->sparse_index = reinterpret_cast<const SparseEntry*>(data);
+				data += d->sparse_index_size * sizeof(SparseEntry);
+			}
+		}
+
+		for (int file = 0; file <= max_file; file++) {
+			for (int i = 0; i < sides; i++) {
+				PairsData* d = e.get(i, file);
+				d->block_length = data;
+				data += d->block_length_size * sizeof(uint16_t);
+			}
+		}
+
+		for (int file = 0; file <= max_file; file++) {
+			for (int i = 0; i < sides; i++) {
+				// 64 byte alignment
+				data = reinterpret_cast<const uint8_t*>((reinterpret_cast<uintptr_t>(data) + 0x3f) & ~uintptr_t(0x3f));
+
+				PairsData* d = e.get(i, file);
+				d->data = data;
+				data += d->blocks_count * d->block_size;
+			}
+		}
+	}
+
+	// Maps the table file on the first probe. Other threads wait for the mapping
+	// only when they probe a table which isn't ready yet.
+	template <TableType Type>
+	bool isMapped(Table<Type>& e, const Position& pos) {
+		static std::mutex mutex;
+
+		if (e.ready.load(std::memory_order_acquire))
+			return e.file.isOpen();
+
+		std::scoped_lock lock(mutex);
+
+		if (e.ready.load(std::memory_order_relaxed))
+			return e.file.isOpen();
+
+		// pieces of both sides from the strongest, e.g. KRP and KR
+		std::string white, black;
+
+		for (int piece_t = Piece::KING; piece_t >= Piece::PAWN; piece_t--) {
+			white += std::string(pos.getPiecesBySide(WHITE, static_cast<Piece::enumType>(piece_t)).popCount(), "PNBRQK"[piece_t]);
+			black += std::string(pos.getPiecesBySide(BLACK, static_cast<Piece::enumType>(piece_t)).popCount(), "PNBRQK"[piece_t]);
+		}
+
+		const std::string name = (e.key == pos.getMaterialKey() ? white + 'v' + black : black + 'v' + white)
+			+ (Type == WDL ? ".rtbw" : ".rtbz");
+
+		static constexpr uint8_t magics[2][4] = {
+			{ 0x71, 0xe8, 0x23, 0x5d },
+			{ 0xd7, 0x66, 0x0c, 0xa5 }
+		};
+
+		for (const auto& dir : tables.paths) {
+			if (!e.file.open(dir + '/' + name))
+				continue;
+
+			// file consists of 64 byte blocks after the header
+			if (e.file.size() % 64 != 16 or std::memcmp(e.file.data(), magics[Type], 4)) {
+				std::cout << "info string corrupted tablebase file " << name << '\n';
+				e.file.close();
+				break;
+			}
+
+			setup(e, e.file.data() + 4);
+			break;
+		}
+
+		e.ready.store(true, std::memory_order_release);
+		return e.file.isOpen();
+	}
+
+	template <TableType Type>
+	typename Table<Type>::Ret probeTable(const Position& pos, ProbeState& state, WDLScore wdl = DRAW) {
+		using Ret = typename Table<Type>::Ret;
+
+		// bare kings
+		if (pos.getOccupied().popCount() == 2)
+			return Ret(DRAW);
+
+		Table<Type>* entry = tables.get<Type>(pos.getMaterialKey());
+
+		if (!entry or !isMapped(*entry, pos)) {
+			state = FAIL;
+			return Ret();
+		}
+
+		return probeTable(pos, entry, wdl, state);
+	}
+
+	INLINE bool isZeroing(Move move) {
+		return move.isCapture() or move.getPerformerT() == Piece::PAWN;
+	}
+
+	bool hasLegalMove(Position& pos) {
+		MoveList move_list;
+		MoveGen::generatePseudoLegalMoves<MoveGen::ALL>(pos, move_list);
+
+		for (size_t i = 0; i < move_list.count(); i++) {
+			Move move = move_list.getMove(i);
+			Position::IrreversibleState state;
+
+			const bool legal = pos.make(move, state);
+			pos.unmake(move, state);
+
+			if (legal)
+				return true;
+		}
+
+		return false;
+	}
+
+	/*
+		Tables store "don't care" values for positions where the side to move has a winning capture,
+		and may store a loss instead of a draw if the side to move can draw with a capture. So the result
+		of a position is the best of the table value and the results after captures. DTZ tables
+		don't store values when the best move is zeroing, so for DTZ all the pawn moves are tried too.
+	*/
+	template <bool CheckZeroingMoves>
+	WDLScore search(Position& pos, ProbeState& state) {
+		MoveList move_list;
+		MoveGen::generatePseudoLegalMoves<MoveGen::ALL>(pos, move_list);
+
+		WDLScore best = LOSS;
+		size_t legal_count = 0,
+			   searched_count = 0;
+
+		for (size_t i = 0; i < move_list.count(); i++) {
+			Move move = move_list.getMove(i);
+			Position::IrreversibleState irreversible;
+
+			if (!pos.make(move, irreversible)) {
+				pos.unmake(move, irreversible);
+				continue;
+			}
+
+			legal_count++;
+
+			if (!move.isCapture() and (!CheckZeroingMoves or move.getPerformerT() != Piece::PAWN)) {
+				pos.unmake(move, irreversible);
+				continue;
+			}
+
+			searched_count++;
+
+			const WDLScore value = static_cast<WDLScore>(-search<false>(pos, state));
+			pos.unmake(move, irreversible);
+
+			if (state == FAIL)
+				return DRAW;
+
+			if (value > best) {
+				best = value;
+
+				if (value >= WIN) {
+					state = ZEROING_BEST_MOVE;
+					return value;
+				}
+			}
+		}
+
+		// when all the moves have been searched, the table value isn't needed - and it could be wrong,
+		// e.g. tables don't know about en passant
+		const bool no_more_moves = searched_count and searched_count == legal_count;
+		WDLScore value = best;
+
+		if (!no_more_moves) {
+			value = probeTable<WDL>(pos, state);
+
+			if (state == FAIL)
+				return DRAW;
+		}
+
+		// table stores a "don't care" value when the best capture wins
+		if (best >= value) {
+			state = best > DRAW or no_more_moves ? ZEROING_BEST_MOVE : OK;
+			return best;
+		}
+
+		state = OK;
+		return value;
+	}
+
+	// DTZ of a position right before a zeroing move, it depends only on the result
+	INLINE int dtzBeforeZeroing(WDLScore wdl) {
+		return wdl == WIN ? 1
+			: wdl == CURSED_WIN ? 101
+			: wdl == BLESSED_LOSS ? -101
+			: wdl == LOSS ? -1 : 0;
+	}
+
+	INLINE int sign(int value) {
+		return (value > 0) - (value < 0);
+	}
+
+} // namespace
+
+size_t Syzygy::init(const std::string& paths) {
+	tables.clear();
+	tables.paths.clear();
+
+	if (paths.empty() or paths == "<empty>")
+		return 0;
+
+#if defined(_WIN32)
+	static constexpr char separator = ';';
+#else
+	static constexpr char separator = ':';
+#endif
+
+	for (size_t begin = 0, end; begin <= paths.size(); begin = end + 1) {
+		end = std::min(paths.find(separator, begin), paths.size());
+
+		if (end > begin)
+			tables.paths.push_back(paths.substr(begin, end - begin));
+	}
+
+	using enum Piece::enumType;
+
+	// all the materials up to 7 pieces, the stronger side first
+	for (int p1 = PAWN; p1 < KING; p1++) {
+		const auto t1 = static_cast<Piece::enumType>(p1);
+		tables.add({ KING, t1, KING });
+
+		for (int p2 = PAWN; p2 <= p1; p2++) {
+			const auto t2 = static_cast<Piece::enumType>(p2);
+			tables.add({ KING, t1, t2, KING });
+			tables.add({ KING, t1, KING, t2 });
+
+			for (int p3 = PAWN; p3 < KING; p3++)
+				tables.add({ KING, t1, t2, KING, static_cast<Piece::enumType>(p3) });
+
+			for (int p3 = PAWN; p3 <= p2; p3++) {
+				const auto t3 = static_cast<Piece::enumType>(p3);
+				tables.add({ KING, t1, t2, t3, KING });
+
+				for (int p4 = PAWN; p4 <= p3; p4++) {
+					const auto t4 = static_cast<Piece::enumType>(p4);
+					tables.add({ KING, t1, t2, t3, t4, KING });
+
+					for (int p5 = PAWN; p5 <= p4; p5++)
+						tables.add({ KING, t1, t2, t3, t4, static_cast<Piece::enumType>(p5), KING });
+
+					for (int p5 = PAWN; p5 < KING; p5++)
+						tables.add({ KING, t1, t2, t3, t4, KING, static_cast<Piece::enumType>(p5) });
+				}
+
+				for (int p4 = PAWN; p4 < KING; p4++) {
+					const auto t4 = static_cast<Piece::enumType>(p4);
+					tables.add({ KING, t1, t2, t3, KING, t4 });
+
+					for (int p5 = PAWN; p5 <= p4; p5++)
+						tables.add({ KING, t1, t2, t3, KING, t4, static_cast<Piece::enumType>(p5) });
+				}
+			}
+
+			for (int p3 = PAWN; p3 <= p1; p3++) {
+				for (int p4 = PAWN; p4 <= (p1 == p3 ? p2 : p3); p4++)
+					tables.add({ KING, t1, t2, KING, static_cast<Piece::enumType>(p3), static_cast<Piece::enumType>(p4) });
+			}
+		}
+	}
+
+	return tables.count();
+}
+
+int Syzygy::maxCardinality() {
+	return tables.max_cardinality;
+}
+
+Syzygy::WDLScore Syzygy::probeWdl(Position& pos, ProbeState& state) {
+	state = OK;
+	return search<false>(pos, state);
+}
+
+int Syzygy::probeDtz(Position& pos, ProbeState& state) {
+	state = OK;
+	const WDLScore wdl = search<true>(pos, state);
+
+	// draws aren't stored
+	if (state == FAIL or wdl == DRAW)
+		return 0;
+
+	if (state == ZEROING_BEST_MOVE)
+		return dtzBeforeZeroing(wdl);
+
+	int dtz = probeTable<DTZ>(pos, state, wdl);
+
+	if (state == FAIL)
+		return 0;
+
+	if (state != CHANGE_STM)
+		return (dtz + 100 * (wdl == BLESSED_LOSS or wdl == CURSED_WIN)) * sign(wdl);
+
+	// table stores the other side to move: one ply search for the move with minimal DTZ
+	MoveList move_list;
+	MoveGen::generatePseudoLegalMoves<MoveGen::ALL>(pos, move_list);
+
+	int min_dtz = 0xffff;
+
+	for (size_t i = 0; i < move_list.count(); i++) {
+		Move move = move_list.getMove(i);
+		Position::IrreversibleState irreversible;
+
+		const bool zeroing = isZeroing(move);
+
+		if (!pos.make(move, irreversible)) {
+			pos.unmake(move, irreversible);
+			continue;
+		}
+
+		// for zeroing moves DTZ before the move is needed, with the result sign after it
+		dtz = zeroing ? -dtzBeforeZeroing(search<false>(pos, state)) : -probeDtz(pos, state);
+
+		// mate
+		if (dtz == 1 and pos.isInCheck(pos.getTurn()) and !hasLegalMove(pos))
+			min_dtz = 1;
+
+		if (!zeroing)
+			dtz += sign(dtz);
+
+		if (dtz < min_dtz and sign(dtz) == sign(wdl))
+			min_dtz = dtz;
+
+		pos.unmake(move, irreversible);
+
+		if (state == FAIL)
+			return 0;
+	}
+
+	// no legal moves - mated
+	return min_dtz == 0xffff ? -1 : min_dtz;
+}
+
+bool Syzygy::rankRootMoves(Position& pos, RootMoveList& root_moves, bool repeated, bool& dtz_ranked) {
+	ProbeState state = OK;
+	const int halfmove_clock = pos.halfmoveClock();
+
+	dtz_ranked = true;
+
+	for (size_t i = 0; i < root_moves.count(); i++) {
+		RootMove& root_move = root_moves[i];
+		Position::IrreversibleState irreversible;
+		int dtz;
+
+		pos.make(root_move.move, irreversible);
+
+		// DTZ counted from the root position
+		if (!pos.halfmoveClock())
+			dtz = dtzBeforeZeroing(static_cast<WDLScore>(-probeWdl(pos, state)));
+		else {
+			dtz = -probeDtz(pos, state);
+			dtz += sign(dtz);
+		}
+
+		// mating move
+		if (dtz == 2 and pos.isInCheck(pos.getTurn()) and !hasLegalMove(pos))
+			dtz = 1;
+
+		pos.unmake(root_move.move, irreversible);
+
+		if (state == FAIL) {
+			dtz_ranked = false;
+			break;
+		}
+
+		// Wins in reach of 50-move rule are ranked equally, otherwise quicker zeroing is better.
+		// Losses are ranked equally unless a 50-move draw is in sight.
+		root_move.tb_rank = dtz > 0 ? (dtz + halfmove_clock <= 99 and !repeated ? 1000 : 1000 - (dtz + halfmove_clock))
+						  : dtz < 0 ? (-dtz * 2 + halfmove_clock < 100 ? -1000 : -1000 + (-dtz + halfmove_clock))
+						  : 0;
+	}
+
+	// without DTZ tables moves are ranked by their results only
+	if (!dtz_ranked) {
+		static constexpr int wdl_rank[] = { -1000, -899, 0, 899, 1000 };
+
+		for (size_t i = 0; i < root_moves.count(); i++) {
+			RootMove& root_move = root_moves[i];
+			Position::IrreversibleState irreversible;
+
+			pos.make(root_move.move, irreversible);
+			const WDLScore wdl = static_cast<WDLScore>(-probeWdl(pos, state));
+			pos.unmake(root_move.move, irreversible);
+
+			if (state == FAIL)
+				return false;
+
+			root_move.tb_rank = wdl_rank[wdl + 2];
+		}
+	}
+
+	root_moves.keepBestRanked();
+	return true;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Position.hpp"
+#include "RootMoveList.hpp"
+
+/*
+	Syzygy endgame tablebases probing, following the original probing code by Ronald de Man
+	and its rewrite in Stockfish. WDL tables give the game result under 50-move rule, DTZ tables
+	give distance to the next zeroing move, which is enough to make progress in won endings.
+	Table files are memory mapped on the first probe of their material, probing itself doesn't
+	allocate and it's safe to probe from any number of threads.
+*/
+namespace Syzygy {
+
+	// result from the side to move point of view, cursed wins and blessed losses are drawn by 50-move rule
+	enum WDLScore : int {
+		LOSS = -2,
+		BLESSED_LOSS = -1,
+		DRAW = 0,
+		CURSED_WIN = 1,
+		WIN = 2
+	};
+
+	enum ProbeState : int {
+		FAIL = 0,
+		OK = 1,
+		// DTZ table stores the other side to move
+		CHANGE_STM = -1,
+		// the best move is a capture or a pawn move
+		ZEROING_BEST_MOVE = 2
+	};
+
+	static constexpr int max_pieces = 7;
+
+	// registers all the tables found in directories of the list, separated by ':' (';' on Windows).
+	// Empty path or "<empty>" drops the tables. Returns number of tables found.
+	size_t init(const std::string& paths);
+
+	// the biggest number of pieces of available tables, zero when there are none
+	int maxCardinality();
+
+	// positions with castling rights aren't in tablebases
+	INLINE bool isProbeable(const Position& pos) {
+		return pos.getOccupied().popCount() <= maxCardinality()
+			and !pos.getCastlingByColor(WHITE).isAnyPossible()
+			and !pos.getCastlingByColor(BLACK).isAnyPossible();
+	}
+
+	WDLScore probeWdl(Position& pos, ProbeState& state);
+
+	// plies to zeroing move, signed as the result: positive for wins, negative for losses,
+	// 100 plies more for cursed wins and blessed losses
+	int probeDtz(Position& pos, ProbeState& state);
+
+	// Ranks root moves with DTZ tables, or with WDL tables when DTZ ones are missing, and keeps
+	// only the best ranked moves. Wins that fit in 50-move rule are ranked equally.
+	// Returns false when some of the moves couldn't be probed - the list is left untouched then.
+	bool rankRootMoves(Position& pos, RootMoveList& root_moves, bool repeated, bool& dtz_ranked);
+
+} // namespace Syzygy
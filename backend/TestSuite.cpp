@@ -0,0 +1,166 @@
+#include "TestSuite.hpp"
+#include "MappedFile.hpp"
+#include "Pgn.hpp"
+#include "Search.hpp"
+#include "TranspositionTable.hpp"
+
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <thread>
+
+namespace {
+
+	// nearest-rank percentile of sorted values
+	template <typename T>
+	T percentile(const std::vector<T>& sorted, unsigned p) {
+		if (sorted.empty())
+			return 0;
+
+		const size_t rank = (sorted.size() * std::min(p, 100U) + 99) / 100;
+		return sorted[std::max<size_t>(rank, 1) - 1];
+	}
+
+} // namespace
+
+bool TestSuite::run(const std::string& epd_path, const Settings& settings) {
+	_stats = Stats();
+	_results.clear();
+
+	MappedFile epd;
+
+	if (!epd.open(epd_path))
+		return false;
+
+	const std::vector<std::string_view> lines = Epd::splitLines(epd.view());
+	const unsigned threads = std::max(settings.threads, 1U);
+
+	std::atomic<size_t> next_line = 0;
+	std::vector<Result> results(lines.size());
+	std::vector<uint8_t> valid(lines.size());
+
+	auto work = [&] {
+		TranspositionTable tt;
+		tt.resize(std::bit_floor(std::max<size_t>(settings.hash_mb, 1)));
+
+		const auto search = std::make_unique<Search>(tt);
+		search->setPrintInfo(false);
+
+		Position pos;
+		Game game;
+		EpdRecord record;
+
+		for (size_t idx; (idx = next_line++) < lines.size(); ) {
+			if (!Epd::parse(lines[idx], record, pos))
+				continue;
+
+			tt.reset();
+			results[idx].line_no = idx + 1;
+			valid[idx] = solve(record, *search, pos, game, settings, results[idx]);
+		}
+	};
+
+	std::vector<std::thread> workers;
+
+	for (unsigned i = 0; i < threads; i++)
+		workers.emplace_back(work);
+
+	for (auto& worker : workers)
+		worker.join();
+
+	for (size_t i = 0; i < lines.size(); i++) {
+		if (!valid[i]) {
+			_stats.skipped += results[i].line_no != 0;
+			continue;
+		}
+
+		_stats.positions++;
+		_stats.solved += results[i].solved;
+		_stats.nodes += results[i].nodes;
+		_results.push_back(std::move(results[i]));
+	}
+
+	return true;
+}
+
+bool TestSuite::solve(const EpdRecord& record, Search& search, Position& pos, Game& game, const Settings& settings,
+	Result& result) const {
+	const std::vector<Move> best_moves = parseMoves(record, "bm", pos),
+							avoid_moves = parseMoves(record, "am", pos);
+
+	if (best_moves.empty() and avoid_moves.empty())
+		return false;
+
+	SearchLimits limits;
+	limits.depth = settings.depth ? std::min(settings.depth, max_depth - 1) : max_depth - 1;
+	limits.nodes = settings.nodes;
+	limits.movetime = settings.depth or settings.nodes or settings.movetime ? settings.movetime : default_movetime;
+
+	game.clear();
+	search.clearCounterMoves();
+
+	const uint64_t nodes = search.bestMove(pos, game, limits);
+	const SearchResults& results = search.getResults();
+
+	const auto isRight = [&](Move move) {
+		return (best_moves.empty() or std::find(best_moves.begin(), best_moves.end(), move) != best_moves.end())
+			and std::find(avoid_moves.begin(), avoid_moves.end(), move) == avoid_moves.end();
+	};
+
+	// the last iteration with a wrong best move, solving iteration is the next one
+	size_t solve_idx = results.iterations.size();
+
+	while (solve_idx and isRight(results.iterations[solve_idx - 1].best_move))
+		solve_idx--;
+
+	const auto* id = record.find("id");
+
+	result.id = id and !id->empty() ? id->front() : "line " + std::to_string(result.line_no);
+	result.best_move = results.best_move;
+	result.nodes = nodes;
+	result.solved = solve_idx < results.iterations.size();
+	result.solve_depth = result.solved ? static_cast<unsigned>(solve_idx + 1) : 0;
+	result.solve_time = result.solved ? results.iterations[solve_idx].time : 0;
+	result.solve_nodes = result.solved ? results.iterations[solve_idx].nodes : 0;
+
+	return true;
+}
+
+std::vector<Move> TestSuite::parseMoves(const EpdRecord& record, std::string_view opcode, Position& pos) {
+	std::vector<Move> moves;
+
+	if (const auto* operands = record.find(opcode)) {
+		for (const auto& san : *operands) {
+			const Move move = Pgn::parseSan(pos, san);
+
+			if (!move.isNull())
+				moves.push_back(move);
+		}
+	}
+
+	return moves;
+}
+
+int64_t TestSuite::timePercentile(unsigned p) const {
+	std::vector<int64_t> times;
+
+	for (const auto& result : _results) {
+		if (result.solved)
+			times.push_back(result.solve_time);
+	}
+
+	std::sort(times.begin(), times.end());
+	return percentile(times, p);
+}
+
+uint64_t TestSuite::nodesPercentile(unsigned p) const {
+	std::vector<uint64_t> nodes;
+
+	for (const auto& result : _results) {
+		if (result.solved)
+			nodes.push_back(result.solve_nodes);
+	}
+
+	std::sort(nodes.begin(), nodes.end());
+	return percentile(nodes, p);
+}
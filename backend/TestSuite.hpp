@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Epd.hpp"
+#include "Move.hpp"
+
+#include <vector>
+
+class Search;
+class Position;
+class Game;
+
+/*
+	Runs test suites like WAC or STS: EPD positions with best moves (bm) or moves to avoid (am).
+	Positions are searched in parallel, each worker with its own Search and hash table, which is
+	cleared before every position, so results don't depend on the order the positions are taken in.
+	A position is solved when the best move of the last completed iteration is right. It's solved
+	at the first iteration since which all the iterations have had the right best move,
+	time and nodes to solve are taken from that iteration.
+*/
+class TestSuite {
+public:
+	struct Settings {
+		unsigned depth = 0,
+				 movetime = 0;
+		uint64_t nodes = 0;
+		unsigned threads = 1;
+		size_t hash_mb = 16;
+	};
+
+	struct Result {
+		size_t   line_no = 0;
+		std::string id;
+		bool     solved = false;
+		Move     best_move = Move::null;
+		uint64_t nodes = 0;
+		// of the iteration the position is solved at
+		unsigned solve_depth = 0;
+		int64_t  solve_time = 0;
+		uint64_t solve_nodes = 0;
+	};
+
+	struct Stats {
+		uint64_t positions = 0,
+				 solved = 0,
+				 skipped = 0,
+				 nodes = 0;
+	};
+
+	// returns false when the file can't be read
+	bool run(const std::string& epd_path, const Settings& settings);
+
+	// results of the positions in order of the file
+	INLINE const std::vector<Result>& getResults() const { return _results; }
+	INLINE const Stats& getStats() const { return _stats; }
+
+	// p-th percentile (0-100) of time to solve, over the solved positions
+	int64_t timePercentile(unsigned p) const;
+	uint64_t nodesPercentile(unsigned p) const;
+private:
+	// position of the record is already set by Epd::parse, returns false when it has neither bm nor am moves
+	bool solve(const EpdRecord& record, Search& search, Position& pos, Game& game, const Settings& settings,
+		Result& result) const;
+
+	// moves of bm or am operation, SAN moves which aren't legal are left out
+	static std::vector<Move> parseMoves(const EpdRecord& record, std::string_view opcode, Position& pos);
+
+	// movetime of a suite without any limit
+	static constexpr unsigned default_movetime = 1000;
+
+	std::vector<Result> _results;
+	Stats _stats;
+};
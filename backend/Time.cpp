@@ -2,6 +2,9 @@
 #include "Search.hpp"
 
 unsigned TimeMan::searchTime(const Position& pos, SearchLimits& limits) {
+	if (limits.movetime)
+		return limits.movetime;
+
 	return pos.getTurn() == WHITE ? (limits.wtime / 20 + limits.winc / 2)
 								  : (limits.btime / 20 + limits.binc / 2);
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+#include "TrainingData.hpp"
+
+TrainingEntry TrainingEntry::pack(const Position& pos, int16_t score, enumResult result) {
+	const PackedPosition packed = PackedPosition::pack(pos);
+
+	TrainingEntry entry = {};
+	entry.occupancy = packed.occupancy;
+	entry.pieces = packed.pieces;
+	entry.score = score;
+	entry.result = result;
+	entry.state = packed.state;
+	entry.ep_square = packed.ep_square;
+	entry.halfmove_count = packed.halfmove_count;
+	entry.fullmove_count = packed.fullmove_count;
+
+	return entry;
+}
+
+void TrainingEntry::unpack(Position& pos) const {
+	toPacked().unpack(pos);
+}
+
+bool TrainingEntry::isValid() const {
+	const int count = Intrinsics::popCount64(occupancy);
+
+	if (count > 32 or result > WHITE_WIN or ep_square > 64)
+		return false;
+
+	std::array<int, 2> kings = {};
+
+	for (int i = 0; i < count; i++) {
+		const uint8_t code = pieces[i / 2] >> (i % 2 * 4) & 0xf;
+
+		if ((code & 7) > Piece::KING)
+			return false;
+		if ((code & 7) == Piece::KING)
+			kings[code >> 3]++;
+	}
+
+	return kings[WHITE] == 1 and kings[BLACK] == 1;
+}
+
+PackedPosition TrainingEntry::toPacked() const {
+	PackedPosition packed = {};
+	packed.occupancy = occupancy;
+	packed.pieces = pieces;
+	packed.fullmove_count = fullmove_count;
+	packed.state = state;
+	packed.ep_square = ep_square;
+	packed.halfmove_count = halfmove_count;
+
+	return packed;
+}
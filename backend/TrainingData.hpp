@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Common.hpp"
+#include "PackedPosition.hpp"
+
+/*
+	Labelled position of training data in 32 bytes, written as it is in memory (little endian).
+	Pieces are encoded like in PackedPosition, fields follow in another order to make room for the labels.
+	Score of the search and game result are both from the point of view of white.
+*/
+struct TrainingEntry {
+	enum enumResult : uint8_t {
+		BLACK_WIN = 0, DRAW = 1, WHITE_WIN = 2
+	};
+
+	static TrainingEntry pack(const Position& pos, int16_t score, enumResult result);
+	void unpack(Position& pos) const;
+
+	// fields of a record read from a file can be unpacked: at most 32 pieces of valid types,
+	// one king of each color, known result and en passant square
+	bool isValid() const;
+
+	PackedPosition toPacked() const;
+
+	// result as a score of white: 0, 0.5 or 1
+	INLINE float resultScore() const { return static_cast<float>(result) / 2; }
+
+	uint64_t occupancy;
+	std::array<uint8_t, 16> pieces;
+	int16_t score;
+	enumResult result;
+	// side to move in bit 0, castling rights KQkq in bits 1-4
+	uint8_t state;
+	// en passant square, 64 when there is none
+	uint8_t ep_square;
+	uint8_t halfmove_count;
+	uint16_t fullmove_count;
+};
+
+static_assert(sizeof(TrainingEntry) == 32);
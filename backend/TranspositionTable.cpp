@@ -1,6 +1,6 @@
 #include "TranspositionTable.hpp"
 
-inline constexpr size_t operator""_MB(size_t mb_count) {
+inline constexpr size_t operator""_MB(unsigned long long mb_count) {
 	return mb_count * 1024 * 1024;
 }
 
@@ -32,6 +32,10 @@ void TranspositionTable::clear() {
 	_size = 0;
 }
 
+void TranspositionTable::reset() {
+	std::fill(_mem, _mem + _size, TTEntry{});
+}
+
 void TranspositionTable::write(uint64_t node_key, uint8_t node_depth, uint8_t node_ply, 
 	TTEntry::Bound node_bound, Score node_score, Move node_move, SearchResults& results) {
 	if (node_score > Score::infinity - static_cast<int16_t>(max_depth))
@@ -59,7 +63,7 @@ bool TranspositionTable::probe(TTEntry& out_entry, uint64_t key, Score alpha, Sc
 	}
 
 	switch (entry->bound) {
-	case TTEntry::EXACT:
+	case TTEntry::EXACT: {
 		const Score mate_score = entry->score > Score::infinity  - static_cast<int16_t>(max_depth) ? 
 								 entry->score - node_ply :
 								 entry->score < -Score::infinity + static_cast<int16_t>(max_depth) ? 
@@ -69,6 +73,7 @@ bool TranspositionTable::probe(TTEntry& out_entry, uint64_t key, Score alpha, Sc
 		out_entry = *entry;
 		out_entry.score = mate_score;
 		return true;
+	}
 	case TTEntry::LOWERBOUND:
 		out_entry = *entry;
 		out_entry.score = alpha;
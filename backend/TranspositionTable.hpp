@@ -29,12 +29,17 @@ public:
 
 	void resize(size_t size_mb);
 	void clear();
+	// empty all the entries, keeping allocated memory
+	void reset();
 
 	void write(uint64_t node_key, uint8_t node_depth, uint8_t node_ply, 
 		TTEntry::Bound node_bound, Score node_score, Move node_move, SearchResults& results);
 
 	bool probe(TTEntry& out_entry, uint64_t key, Score alpha, Score beta, uint8_t node_depth, uint8_t node_ply);
 
+	// start loading entry of given key into cache, long before it's probed
+	void prefetch(uint64_t key) const;
+
 #if defined(_DEBUG)
 	void printDebug();
 #endif
@@ -54,4 +59,8 @@ private:
 
 inline size_t TranspositionTable::getEntriesCount() const {
 	return _size;
+}
+
+INLINE void TranspositionTable::prefetch(uint64_t key) const {
+	Intrinsics::prefetch(_mem + (key & (_size - 1)));
 }
\ No newline at end of file
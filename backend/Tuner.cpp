@@ -0,0 +1,504 @@
+#include "Tuner.hpp"
+#include "Epd.hpp"
+#include "Eval.hpp"
+#include "Fen.hpp"
+#include "MappedFile.hpp"
+#include "Time.hpp"
+#include "TrainingData.hpp"
+
+#include <barrier>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <thread>
+
+namespace {
+
+	constexpr std::array<const char*, 6> piece_names = { "pawn", "knight", "bishop", "rook", "queen", "king" };
+
+	// white point of view, 0 loss to 2 win
+	bool parseResult(std::string_view str, uint8_t& result) {
+		if (str == "1-0" or str == "1.0" or str == "1")
+			result = 2;
+		else if (str == "1/2-1/2" or str == "0.5" or str == "1/2")
+			result = 1;
+		else if (str == "0-1" or str == "0.0" or str == "0")
+			result = 0;
+		else
+			return false;
+
+		return true;
+	}
+
+	// FEN or EPD followed by result in brackets, or EPD with c9 operation. The position is set
+	// whenever its fields are valid, even if the label isn't.
+	bool parseLabelled(std::string_view line, Position& pos, uint8_t& result) {
+		std::string_view rest;
+
+		if (!Fen::parse(line, pos, nullptr, &rest))
+			return false;
+
+		if (!rest.empty() and rest.front() == '[') {
+			const size_t close = rest.find(']');
+			return close != std::string_view::npos and parseResult(rest.substr(1, close - 1), result);
+		}
+
+		const std::string_view c9 = Epd::findOperand(rest, "c9");
+		return !c9.empty() and parseResult(c9, result);
+	}
+
+	INLINE bool isBlankOrComment(std::string_view line) {
+		const size_t first = line.find_first_not_of(" \t\r");
+		return first == std::string_view::npos or line[first] == '#';
+	}
+
+	INLINE float sigmoid(float x) {
+		return 1 / (1 + std::exp(-x));
+	}
+
+	// values rounded and aligned to the widest one, rows of eight values
+	std::string tableStr(const std::string& name, const float* values) {
+		std::array<std::string, 64> strs;
+		size_t width = 0;
+
+		for (int i = 0; i < 64; i++) {
+			strs[i] = std::to_string(static_cast<int>(std::lround(values[i])));
+			width = std::max(width, strs[i].size());
+		}
+
+		std::string res = "constexpr std::array<int16_t, 64> Eval::" + name + " = {\n";
+
+		for (int i = 0; i < 64; i++) {
+			res += i % 8 ? ' ' : '\t';
+			res.append(width - strs[i].size(), ' ');
+			res += strs[i];
+			res += i % 8 == 7 ? ",\n" : ",";
+		}
+
+		return res + "};\n\n";
+	}
+
+} // namespace
+
+bool Tuner::addPosition(const Position& pos, Eval& eval, int16_t score, uint8_t result,
+	std::vector<Entry>& entries, std::vector<Feature>& features) {
+	MaterialEntry material;
+	eval.materialInfoOnFly(pos, material);
+
+	if (material.endgame)
+		return false;
+
+	PawnEntry pawns;
+	eval.pawnStructureOnFly(pos, pawns);
+
+	Entry entry;
+	entry.first = static_cast<uint32_t>(features.size());
+
+	PackedScore psqt = PackedScore(0, 0);
+
+	for (enumColor side : { WHITE, BLACK }) {
+		for (auto piece_t : Piece::piece_list) {
+			for (uint64_t bb = pos.getPiecesBySide(side, piece_t); bb; bb &= bb - 1) {
+				const unsigned sq = Intrinsics::bitScanForward64(bb);
+
+				// white squares are flipped to the table order, like in Eval::generatePsqt
+				features.push_back(static_cast<Feature>((piece_t * 64 + (side == WHITE ? sq ^ 56 : sq))
+					| (side == BLACK ? _black_feature : 0)));
+				psqt += Eval::_psqt[side][piece_t][sq];
+			}
+		}
+	}
+
+	const PackedScore fixed = pawns.score + material.score;
+	const int16_t white_score = (psqt + fixed).taper(material.phase);
+	const enumColor side = pos.getTurn();
+
+	// scale is taken for the side leading with the current tables
+	const enumColor leading = (side == WHITE ? white_score : -white_score) >= 0 ? side : !side;
+
+	entry.count = static_cast<uint8_t>(features.size() - entry.first);
+	entry.phase = material.phase;
+	entry.scale = static_cast<uint8_t>(eval.scaleFactor(pos, material, leading));
+	entry.result = result;
+	entry.fixed_mg = fixed.mg();
+	entry.fixed_eg = fixed.eg();
+	entry.score = score;
+
+	entries.push_back(entry);
+	return true;
+}
+
+bool Tuner::load(const std::string& path, unsigned threads) {
+	_entries.clear();
+	_features.clear();
+	_stats = Stats();
+
+	MappedFile file;
+
+	if (!file.open(path))
+		return false;
+
+	const bool binary = path.ends_with(".bin");
+
+	// truncated or not a file of TrainingEntry records
+	if (binary and file.size() % sizeof(TrainingEntry))
+		return false;
+
+	const std::vector<std::string_view> lines = binary ? std::vector<std::string_view>() : Epd::splitLines(file.view());
+	const size_t count = binary ? file.size() / sizeof(TrainingEntry) : lines.size();
+
+	struct Chunk {
+		std::vector<Entry> entries;
+		std::vector<Feature> features;
+		uint64_t skipped = 0;
+	};
+
+	threads = std::max(threads, 1U);
+
+	std::vector<Chunk> chunks(threads);
+	std::vector<std::thread> workers;
+
+	for (unsigned i = 0; i < threads; i++) {
+		workers.emplace_back([&, i]() {
+			Chunk& chunk = chunks[i];
+			// each thread evaluates with its own pawn and material tables
+			auto eval = std::make_unique<Eval>();
+			Position pos;
+
+			for (size_t idx = count * i / threads; idx < count * (i + 1) / threads; idx++) {
+				int16_t score = Score::undef;
+				uint8_t result;
+
+				if (binary) {
+					TrainingEntry training_entry;
+					std::memcpy(&training_entry, file.data() + idx * sizeof(TrainingEntry), sizeof(TrainingEntry));
+
+					if (!training_entry.isValid()) {
+						chunk.skipped++;
+						continue;
+					}
+
+					training_entry.unpack(pos);
+					score = training_entry.score;
+					result = training_entry.result;
+				}
+				else if (isBlankOrComment(lines[idx]))
+					continue;
+				else if (!parseLabelled(lines[idx], pos, result)) {
+					chunk.skipped++;
+					continue;
+				}
+
+				if (pos.isInCheck(!pos.getTurn()) or !addPosition(pos, *eval, score, result, chunk.entries, chunk.features))
+					chunk.skipped++;
+			}
+		});
+	}
+
+	for (auto& worker : workers)
+		worker.join();
+
+	for (auto& chunk : chunks) {
+		const uint32_t offset = static_cast<uint32_t>(_features.size());
+
+		for (Entry& entry : chunk.entries)
+			entry.first += offset;
+
+		_entries.insert(_entries.end(), chunk.entries.begin(), chunk.entries.end());
+		_features.insert(_features.end(), chunk.features.begin(), chunk.features.end());
+		_stats.skipped += chunk.skipped;
+
+		chunk = Chunk();
+	}
+
+	_stats.positions = _entries.size();
+	return true;
+}
+
+Tuner::Params Tuner::initialParams() {
+	const std::array<const std::array<int16_t, 64>*, 6>
+		mg_tables = { &Eval::_mg_pawn_table, &Eval::_mg_knight_table, &Eval::_mg_bishop_table,
+					  &Eval::_mg_rook_table, &Eval::_mg_queen_table, &Eval::_mg_king_table },
+		eg_tables = { &Eval::_eg_pawn_table, &Eval::_eg_knight_table, &Eval::_eg_bishop_table,
+					  &Eval::_eg_rook_table, &Eval::_eg_queen_table, &Eval::_eg_king_table };
+
+	Params params;
+
+	for (auto piece_t : Piece::piece_list) {
+		for (int sq = 0; sq < 64; sq++) {
+			params[0][piece_t * 64 + sq] = (*mg_tables[piece_t])[sq];
+			params[1][piece_t * 64 + sq] = (*eg_tables[piece_t])[sq];
+		}
+
+		params[0][_material_idx + piece_t] = Eval::_mg_value[piece_t];
+		params[1][_material_idx + piece_t] = Eval::_eg_value[piece_t];
+	}
+
+	return params;
+}
+
+void Tuner::toWeights(const Params& params, Weights& weights) {
+	for (size_t i = 0; i < _material_idx; i++) {
+		weights[i][0] = params[0][i] + params[0][_material_idx + i / 64];
+		weights[i][1] = params[1][i] + params[1][_material_idx + i / 64];
+	}
+}
+
+double Tuner::batchError(size_t begin, size_t end, const Weights& weights, double k, double lambda, Weights* grads) const {
+	// sigmoid(K * eval) with the base 10 and 400 cp of Elo
+	const float scaling = static_cast<float>(k * std::log(10.0) / 400),
+				score_weight = static_cast<float>(lambda);
+
+	double error = 0;
+
+	for (size_t i = begin; i < end; i++) {
+		const Entry& entry = _entries[i];
+		const Feature* features = &_features[entry.first];
+
+		float mg = entry.fixed_mg,
+			  eg = entry.fixed_eg;
+
+		for (unsigned j = 0; j < entry.count; j++) {
+			const auto& weight = weights[features[j] & ~_black_feature];
+			const float sign = features[j] & _black_feature ? -1.0f : 1.0f;
+
+			mg += sign * weight[0];
+			eg += sign * weight[1];
+		}
+
+		const float phase = static_cast<float>(entry.phase) / PackedScore::max_phase,
+					scale = static_cast<float>(entry.scale) / MaterialTable::scale_normal,
+					predicted = sigmoid(scaling * scale * (eg + (mg - eg) * phase));
+
+		float target = static_cast<float>(entry.result) / 2;
+
+		if (score_weight > 0 and entry.score != Score::undef)
+			target = score_weight * sigmoid(scaling * entry.score) + (1 - score_weight) * target;
+
+		const float diff = predicted - target;
+		error += diff * diff;
+
+		if (!grads)
+			continue;
+
+		// derivative of the squared error by the eval, split between middlegame and endgame by the phase
+		const float grad = 2 * diff * predicted * (1 - predicted) * scaling * scale,
+					grad_mg = grad * phase,
+					grad_eg = grad - grad_mg;
+
+		for (unsigned j = 0; j < entry.count; j++) {
+			auto& weight_grad = (*grads)[features[j] & ~_black_feature];
+			const float sign = features[j] & _black_feature ? -1.0f : 1.0f;
+
+			weight_grad[0] += sign * grad_mg;
+			weight_grad[1] += sign * grad_eg;
+		}
+	}
+
+	return error;
+}
+
+double Tuner::loss(const Weights& weights, double k, double lambda, unsigned threads) const {
+	threads = std::max(threads, 1U);
+
+	std::vector<double> errors(threads);
+	std::vector<std::thread> workers;
+
+	for (unsigned i = 0; i < threads; i++) {
+		workers.emplace_back([&, i]() {
+			errors[i] = batchError(_entries.size() * i / threads, _entries.size() * (i + 1) / threads, weights, k, lambda, nullptr);
+		});
+	}
+
+	for (auto& worker : workers)
+		worker.join();
+
+	return std::accumulate(errors.begin(), errors.end(), 0.0) / static_cast<double>(_entries.size());
+}
+
+double Tuner::fitK(const Weights& weights, unsigned threads) const {
+	// loss has a single minimum in K, golden section search of it against game results only
+	static constexpr double ratio = 0.6180339887498949;
+
+	double low = 0, high = 4,
+		   x1 = high - ratio * (high - low),
+		   x2 = low + ratio * (high - low),
+		   loss1 = loss(weights, x1, 0, threads),
+		   loss2 = loss(weights, x2, 0, threads);
+
+	for (int i = 0; i < 40; i++) {
+		if (loss1 < loss2) {
+			high = x2, x2 = x1, loss2 = loss1;
+			x1 = high - ratio * (high - low);
+			loss1 = loss(weights, x1, 0, threads);
+		}
+		else {
+			low = x1, x1 = x2, loss1 = loss2;
+			x2 = low + ratio * (high - low);
+			loss2 = loss(weights, x2, 0, threads);
+		}
+	}
+
+	return (low + high) / 2;
+}
+
+bool Tuner::tune(const std::string& out_path, const Settings& settings) {
+	// output is checked before the tuning starts
+	if (_entries.empty() or !write(out_path, initialParams()))
+		return false;
+
+	const unsigned threads = std::max(settings.threads, 1U);
+	const size_t batch_size = std::max<size_t>(settings.batch_size, 1),
+				 batches = (_entries.size() + batch_size - 1) / batch_size;
+
+	Params params = initialParams(), moment1 = {}, moment2 = {};
+	Weights weights;
+
+	toWeights(params, weights);
+
+	_stats.k = settings.k > 0 ? settings.k : fitK(weights, threads);
+	_stats.initial_loss = _stats.loss = loss(weights, _stats.k, settings.lambda, threads);
+
+	std::cout << "info string tuning " << _entries.size() << " positions, K " << _stats.k
+		<< ", loss " << _stats.initial_loss << '\n';
+
+	// batches are taken in random order in each epoch
+	std::vector<size_t> order(batches);
+	std::iota(order.begin(), order.end(), size_t(0));
+
+	std::mt19937_64 rng(settings.seed);
+	std::shuffle(order.begin(), order.end(), rng);
+
+	std::vector<Weights> grads(threads, Weights());
+	std::vector<double> errors(threads);
+
+	size_t batch = 0, step = 0;
+	double epoch_error = 0;
+	Timer timer;
+
+	timer.go();
+
+	// run by one of the threads after all of them have finished the batch
+	auto update = [&]() noexcept {
+		static constexpr float beta1 = 0.9f, beta2 = 0.999f, epsilon = 1e-8f;
+
+		const size_t begin = order[batch % batches] * batch_size,
+					 size = std::min(_entries.size(), begin + batch_size) - begin;
+
+		Params grad = {};
+
+		for (unsigned t = 0; t < threads; t++) {
+			for (size_t i = 0; i < _material_idx; i++) {
+				for (int phase : { 0, 1 }) {
+					grad[phase][i] += grads[t][i][phase];
+
+					// material value of a king is always cancelled out
+					if (i / 64 != Piece::KING)
+						grad[phase][_material_idx + i / 64] += grads[t][i][phase];
+				}
+			}
+
+			grads[t] = Weights();
+			epoch_error += errors[t];
+			errors[t] = 0;
+		}
+
+		step++;
+
+		const float correction1 = 1 - std::pow(beta1, static_cast<float>(step)),
+					correction2 = 1 - std::pow(beta2, static_cast<float>(step)),
+					learning_rate = static_cast<float>(settings.learning_rate);
+
+		for (int phase : { 0, 1 }) {
+			for (size_t i = 0; i < _param_count; i++) {
+				const float g = grad[phase][i] / static_cast<float>(size);
+
+				moment1[phase][i] = beta1 * moment1[phase][i] + (1 - beta1) * g;
+				moment2[phase][i] = beta2 * moment2[phase][i] + (1 - beta2) * g * g;
+				params[phase][i] -= learning_rate * (moment1[phase][i] / correction1)
+					/ (std::sqrt(moment2[phase][i] / correction2) + epsilon);
+			}
+		}
+
+		toWeights(params, weights);
+
+		if (++batch % batches)
+			return;
+
+		timer.stop();
+
+		// loss of the epoch is summed up while the weights change
+		_stats.loss = epoch_error / static_cast<double>(_entries.size());
+		epoch_error = 0;
+
+		std::cout << "info string epoch " << batch / batches << " loss " << _stats.loss
+			<< " time " << timer.duration() << " ms\n";
+
+		std::shuffle(order.begin(), order.end(), rng);
+		timer.go();
+	};
+
+	std::barrier sync(static_cast<std::ptrdiff_t>(threads), update);
+	std::vector<std::thread> workers;
+
+	for (unsigned t = 0; t < threads; t++) {
+		workers.emplace_back([&, t]() {
+			for (size_t i = 0; i < settings.epochs * batches; i++) {
+				const size_t begin = order[i % batches] * batch_size,
+							 size = std::min(_entries.size(), begin + batch_size) - begin;
+
+				errors[t] += batchError(begin + size * t / threads, begin + size * (t + 1) / threads,
+					weights, _stats.k, settings.lambda, &grads[t]);
+
+				sync.arrive_and_wait();
+			}
+		});
+	}
+
+	for (auto& worker : workers)
+		worker.join();
+
+	_stats.loss = loss(weights, _stats.k, settings.lambda, threads);
+
+	return write(out_path, params);
+}
+
+bool Tuner::write(const std::string& out_path, const Params& params) const {
+	std::ofstream out(out_path, std::ios::trunc);
+
+	if (!out)
+		return false;
+
+	out << "// material values and PeSTO tables tuned on " << _stats.positions << " positions, K " << _stats.k
+		<< ", loss " << _stats.initial_loss << " -> " << _stats.loss << "\n\n";
+
+	for (auto piece_t : Piece::piece_list) {
+		for (int phase : { 0, 1 })
+			out << tableStr(std::string(phase ? "_eg_" : "_mg_") + piece_names[piece_t] + "_table", &params[phase][piece_t * 64]);
+	}
+
+	std::array<std::array<std::string, 6>, 2> values;
+
+	for (int phase : { 0, 1 }) {
+		for (auto piece_t : Piece::piece_list)
+			values[phase][piece_t] = std::to_string(static_cast<int>(std::lround(params[phase][_material_idx + piece_t])));
+	}
+
+	// columns of middlegame and endgame values are aligned
+	for (int phase : { 0, 1 }) {
+		out << (phase ? "\t\t\t\t\t\t\t\t Eval::_eg_value = { " : "constexpr std::array<int16_t, 6> Eval::_mg_value = { ");
+
+		for (auto piece_t : Piece::piece_list) {
+			const size_t width = std::max(values[0][piece_t].size(), values[1][piece_t].size());
+			out << std::string(width - values[phase][piece_t].size(), ' ') << values[phase][piece_t]
+				<< (piece_t == Piece::KING ? " }" : ", ");
+		}
+
+		out << (phase ? ";\n" : ",\n");
+	}
+
+	return static_cast<bool>(out);
+}
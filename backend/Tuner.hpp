@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Common.hpp"
+
+#include <array>
+#include <vector>
+
+class Position;
+class Eval;
+
+/*
+	Texel tuning of material values and PeSTO tables of Eval on labelled quiet positions. Evaluation is linear
+	in the table entries: each piece adds its middlegame and endgame entry with the sign of its color, the sums
+	are tapered by the phase and multiplied by the scale of the position. So a position is kept just as a list
+	of 16-bit features (table entry and color of each piece) along with the terms which aren't tuned (pawn
+	structure, bishop pair), the phase and the scale, all taken from Eval once when the data is loaded.
+	Positions with a specialised endgame evaluation are skipped.
+
+	Loss is the mean squared error between the game result and the eval mapped by sigmoid(K * eval),
+	where K is fitted to the data first. Gradients of the loss are computed analytically and the tables
+	are trained by Adam on mini-batches, each batch split among the threads.
+
+	Data is either a binary file of TrainingEntry records written by DataGenerator, whose search scores
+	can be blended into the target, or a text file of FEN/EPD lines labelled with c9 "1-0" operation
+	or with a result in brackets like [1.0], [0.5], [0-1].
+*/
+class Tuner {
+public:
+	struct Settings {
+		unsigned epochs = 100,
+				 threads = 1;
+		size_t batch_size = 16384;
+		// Adam step in centipawns
+		double learning_rate = 0.5;
+		// weight of the search score against the game result in the target, scores are known only for binary data
+		double lambda = 0;
+		// sigmoid scaling, fitted to the data when it's 0
+		double k = 0;
+		uint64_t seed = 1;
+	};
+
+	struct Stats {
+		uint64_t positions = 0,
+				 skipped = 0;
+		double k = 0,
+			   initial_loss = 0,
+			   loss = 0;
+	};
+
+	// returns false when the data can't be read or binary data isn't made of whole records,
+	// binary data is told by .bin extension
+	bool load(const std::string& path, unsigned threads);
+
+	// tables are written into out_path as C++ arrays laid out like in Eval.cpp,
+	// returns false when there isn't any position or the output can't be written
+	bool tune(const std::string& out_path, const Settings& settings);
+
+	INLINE const Stats& getStats() const { return _stats; }
+private:
+	// piece type * 64 + square of the table (a8 first), black pieces have the top bit set
+	using Feature = uint16_t;
+
+	static constexpr Feature _black_feature = 0x8000;
+
+	struct Entry {
+		// index of the first feature of the position
+		uint32_t first;
+		uint8_t  count;
+		uint8_t  phase;
+		uint8_t  scale;
+		// white point of view: 0 loss, 1 draw, 2 win
+		uint8_t  result;
+		// terms which aren't tuned, white point of view
+		int16_t  fixed_mg,
+				 fixed_eg;
+		// search score from white point of view, Score::undef when it's unknown
+		int16_t  score;
+	};
+
+	// tables of the piece types followed by material values, for middlegame and endgame
+	static constexpr size_t _material_idx = 6 * 64,
+							_param_count = _material_idx + 6;
+
+	using Params = std::array<std::array<float, _param_count>, 2>;
+
+	// middlegame and endgame value of each feature with the material value included, next to each other
+	using Weights = std::array<std::array<float, 2>, _material_idx>;
+
+	// appends features and entry of the position, returns false when it's skipped
+	static bool addPosition(const Position& pos, Eval& eval, int16_t score, uint8_t result,
+		std::vector<Entry>& entries, std::vector<Feature>& features);
+
+	static Params initialParams();
+	static void toWeights(const Params& params, Weights& weights);
+
+	// mean squared error over all the positions
+	double loss(const Weights& weights, double k, double lambda, unsigned threads) const;
+	double fitK(const Weights& weights, unsigned threads) const;
+
+	// sum of squared errors of the entries, gradients of the weights are accumulated when grads are given
+	double batchError(size_t begin, size_t end, const Weights& weights, double k, double lambda, Weights* grads) const;
+
+	bool write(const std::string& out_path, const Params& params) const;
+
+	std::vector<Entry> _entries;
+	std::vector<Feature> _features;
+	Stats _stats;
+};
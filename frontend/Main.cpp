@@ -1,7 +1,4 @@
 #include "UCI.hpp"
-#include "../backend/Magic.hpp"
-#include "../backend/Attacks.hpp"
-#include "../backend/MoveGen.hpp"
 
 /*
 	NOTES:
@@ -16,9 +13,6 @@
 */
 
 int main(int argc, const char* argv[]) {
-	SlidersMagics::initAttackTables<Piece::BISHOP>();
-	SlidersMagics::initAttackTables<Piece::ROOK>();
-
 	UniversalChessInterface uci_obj;
 	uci_obj.loop(argc, argv);
 }
\ No newline at end of file
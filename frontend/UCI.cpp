@@ -2,32 +2,86 @@
 #include "../backend/Move.hpp"
 #include "../backend/Search.hpp"
 
+#include <fstream>
 #include <sstream>
 
-SearchLimits loadSearchInfo(std::istringstream& strm, std::string token) {
+INLINE bool isMoveStr(const std::string& str) {
+	return (str.size() == 4 or str.size() == 5)
+		and 'a' <= str[0] and str[0] <= 'h' and '1' <= str[1] and str[1] <= '8'
+		and 'a' <= str[2] and str[2] <= 'h' and '1' <= str[3] and str[3] <= '8';
+}
+
+// positions of bench, used as starting points of codecbench too
+constexpr std::array<std::string_view, 8> bench_fens = {
+	"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+	"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+	"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+	"r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+	"r2q1rk1/pP1p2pp/Q4n2/bbp1p3/Np6/1B3NBn/pPPP1PPP/R3K2R b KQ - 0 1",
+	"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+	"6k1/5ppp/8/8/8/8/5PPP/3R2K1 w - - 0 1",
+	"2r3k1/pp3ppp/2n5/3p4/3P4/2P2N2/P4PPP/2R3K1 b - - 0 20",
+};
+
+// decimal number, possibly signed, e.g. 0.05 or -1.5
+INLINE bool parseDecimal(const std::string& str, double& value) {
+	char* end = nullptr;
+	value = std::strtod(str.c_str(), &end);
+	return !str.empty() and *end == '\0';
+}
+
+SearchLimits loadSearchInfo(std::istringstream& strm, std::string token, const Position& pos) {
 	SearchLimits limits;
 	limits.depth = max_depth - 1;
 
-	if (token == "depth") {
-		strm >> std::skipws >> token;
+	for (bool next = !token.empty(); next; next = static_cast<bool>(strm >> std::skipws >> token)) {
+		if (token == "depth") {
+			strm >> std::skipws >> token;
 
-		if (isValidNumber(token.substr(1)) and !isSigned(token)) {
-			limits.depth = std::stoi(token);
+			if (isValidNumber(token.substr(1)) and !isSigned(token)) {
+				limits.depth = std::stoi(token);
+			}
 		}
-	}
-
-	if (token == "wtime") {
-		strm >> std::skipws >> token;
-		limits.wtime = std::stoi(token);
-
-		strm >> std::skipws >> token >> std::skipws >> token;
-		limits.btime = std::stoi(token);
-
-		strm >> std::skipws >> token >> std::skipws >> token;
-		limits.winc = std::stoi(token);
+		else if (token == "mate") {
+			strm >> std::skipws >> token;
 
-		strm >> std::skipws >> token >> std::skipws >> token;
-		limits.binc = std::stoi(token);
+			if (isValidNumber(token) and !token.empty()) {
+				limits.mate = std::stoi(token);
+			}
+		}
+		else if (token == "wtime") {
+			strm >> std::skipws >> token;
+			limits.wtime = std::stoi(token);
+		}
+		else if (token == "btime") {
+			strm >> std::skipws >> token;
+			limits.btime = std::stoi(token);
+		}
+		else if (token == "winc") {
+			strm >> std::skipws >> token;
+			limits.winc = std::stoi(token);
+		}
+		else if (token == "binc") {
+			strm >> std::skipws >> token;
+			limits.binc = std::stoi(token);
+		}
+		else if (token == "movetime") {
+			strm >> std::skipws >> token;
+			limits.movetime = std::stoi(token);
+		}
+		else if (token == "nodes") {
+			strm >> std::skipws >> token;
+			limits.nodes = std::stoull(token);
+		}
+		else if (token == "searchmoves") {
+			// searchmoves list ends with the first token which isn't a move
+			while ((next = static_cast<bool>(strm >> std::skipws >> token)) and isMoveStr(token))
+				limits.search_moves.push(Move::fromStr(pos, token));
+
+			if (!next) break;
+			// token holds next option - handle it in next iteration
+			strm.seekg(-static_cast<std::streamoff>(token.size()), std::ios_base::cur);
+		}
 	}
 
 	return limits;
@@ -40,13 +94,19 @@ void UniversalChessInterface::loop(int argc, const char* argv[]) {
 	// C-style streams aren't used there
 	std::ios_base::sync_with_stdio(false);
 
-	std::cout << "Polish Chess Engine, " << ENGINE_NAME << " by " << AUTHOR << '\n';
+	std::cout << "Polish Chess Engine, " << ENGINE_NAME << " by " << AUTHOR << " (" << ARCH_NAME << ")\n";
 
 	//_pos.setByFEN("1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - - 0 1");
 	//std::cout << _pos.StaticExchangeEval(Square::e5) << '\n';
 
+	// commands given as program arguments are executed one by one, then the engine quits,
+	// e.g. leaf bench or leaf "position startpos" "go perft 5"
+	size_t arg_idx = 1;
+
 	do {
-		if (!std::getline(std::cin, _command))
+		if (argc > 1)
+			_command = arg_idx < static_cast<size_t>(argc) ? argv[arg_idx++] : "quit";
+		else if (!std::getline(std::cin, _command))
 			_command = "quit";
 
 		std::istringstream strm(_command);
@@ -60,6 +120,17 @@ void UniversalChessInterface::loop(int argc, const char* argv[]) {
 		else if (token == "print") _pos.print();
 		else if (token == "go") parseGo(strm);
 		else if (token == "isready") parseIsReady();
+		else if (token == "setoption") parseSetOption(strm);
+		else if (token == "attackbench") parseAttackBench(strm);
+		else if (token == "bench") parseBench(strm);
+		else if (token == "codecbench") parseCodecBench(strm);
+		else if (token == "makebook") parseMakeBook(strm);
+		else if (token == "makebitbase") parseMakeBitbase(strm);
+		else if (token == "analyze") parseAnalyze(strm);
+		else if (token == "testsuite") parseTestSuite(strm);
+		else if (token == "match") parseMatch(strm);
+		else if (token == "datagen") parseDatagen(strm);
+		else if (token == "tune") parseTune(strm);
 
 	} while (_command != "quit");
 }
@@ -67,12 +138,18 @@ void UniversalChessInterface::loop(int argc, const char* argv[]) {
 void UniversalChessInterface::parseUCI() {
 	std::cout << "id name " << ENGINE_NAME << '\n'
 		<< "id author " << AUTHOR << '\n'
+		<< "option name EvalCache type spin default " << EvalCache::default_size_mb << " min 0 max 1024\n"
+		<< "option name OwnBook type check default false\n"
+		<< "option name BookFile type string default <empty>\n"
+		<< "option name SyzygyPath type string default <empty>\n"
+		<< "option name SyzygyProbeDepth type spin default 1 min 1 max 100\n"
+		<< "option name BitbasePath type string default <empty>\n"
 		<< "uciok" << '\n';
 }
 
 inline void UniversalChessInterface::parseNewGame() {
 	_game.clear();
-	MoveOrder<STAGED>::clearCounterMoveHistory();
+	_search.clearCounterMoves();
 }
 
 void UniversalChessInterface::parsePosition(std::istringstream& strm) {
@@ -80,20 +157,20 @@ void UniversalChessInterface::parsePosition(std::istringstream& strm) {
 	strm >> std::skipws >> token;
 
 	if (token == "fen") {
-		std::string given_fen;
+		std::string text;
+		std::getline(strm, text);
 
-		// load piece distribution
-		strm >> std::skipws >> token;
-		given_fen += token;
+		Fen::Error error;
+		std::string_view rest;
 
-		// get side to move, castling rights, en passant square
-		// and get halfmove counter as fullmove counter
-		for (int i = 0; i < 5; i++) {
-			strm >> std::skipws >> token;
-			given_fen += ' ' + token;
+		// nothing changes when the FEN is invalid, moves following it are ignored too
+		if (!Fen::parse(text, _pos, &error, &rest)) {
+			std::cout << "info string invalid fen, " << error.toStr() << '\n';
+			return;
 		}
 
-		_pos.setByFEN(given_fen);
+		_game.clear();
+		strm = std::istringstream(std::string(rest));
 	}
 	else if (token == "startpos") {
 		_pos.setStartingPos();
@@ -128,10 +205,538 @@ inline void UniversalChessInterface::parseGo(std::istringstream& strm) {
 		return;
 	}
 	
-	SearchLimits limits = loadSearchInfo(strm, token);
-	_search.bestMove(_pos, _game, limits);
+	SearchLimits limits = loadSearchInfo(strm, token, _pos);
+
+	if (_own_book and !limits.mate and limits.search_moves.count() == 0) {
+		const Move book_move = _book.probe(_pos);
+
+		if (!book_move.isNull()) {
+			std::cout << "info string book move\nbestmove ";
+			book_move.print();
+			std::cout << '\n';
+			return;
+		}
+	}
+
+	if (limits.mate)
+		_mate_search.bestMove(_pos, limits);
+	else
+		_search.bestMove(_pos, _game, limits);
 }
 
 inline void UniversalChessInterface::parseIsReady() {
 	std::cout << "readyok\n";
 }
+
+// setoption name <id> [value <x>]
+void UniversalChessInterface::parseSetOption(std::istringstream& strm) {
+	std::string token, name, value;
+
+	strm >> std::skipws >> token;
+
+	if (token != "name")
+		return;
+
+	// option names may consist of several words
+	while (strm >> std::skipws >> token and token != "value")
+		name += (name.empty() ? "" : " ") + token;
+
+	while (strm >> std::skipws >> token)
+		value += (value.empty() ? "" : " ") + token;
+
+	if (name == "EvalCache" and isValidNumber(value) and !value.empty())
+		_search.getEval().getCache().resize(std::min(std::stoi(value), 1024));
+	else if (name == "OwnBook")
+		_own_book = value == "true";
+	else if (name == "BookFile") {
+		if (value.empty() or value == "<empty>")
+			_book.close();
+		else if (_book.open(value))
+			std::cout << "info string book " << value << " loaded, " << _book.entriesCount() << " entries\n";
+		else
+			std::cout << "info string can't open book " << value << '\n';
+	}
+	else if (name == "SyzygyPath")
+		std::cout << "info string found " << Syzygy::init(value) << " tablebases\n";
+	else if (name == "SyzygyProbeDepth" and isValidNumber(value) and !value.empty())
+		_search.setTablebaseProbeDepth(std::clamp(std::stoi(value), 1, 100));
+	else if (name == "BitbasePath") {
+		std::cout << "info string found " << Bitbase::init(value) << " bitbases\n";
+		// material entries keep pointers to evaluation of the old bitbases
+		_search.getEval().clear();
+	}
+}
+
+// bench [depth, default 10]
+// fixed depth searches of a constant set of positions, each one with empty hash table and history.
+// Total node count works as a signature of the search, nps measures speed of the build.
+// Debug statistics of each search (null move cutoffs, eval cache and pawn table hits) are printed too.
+void UniversalChessInterface::parseBench(std::istringstream& strm) {
+	std::string token;
+	SearchLimits limits;
+	limits.depth = 10;
+
+	if (strm >> std::skipws >> token and isValidNumber(token) and !token.empty())
+		limits.depth = std::stoi(token);
+
+	Timer timer;
+	timer.go();
+
+	uint64_t nodes = 0;
+	_search.setCollectStats(true);
+
+	for (const auto fen : bench_fens) {
+		_pos.setByFEN(fen);
+		_tt.reset();
+		parseNewGame();
+
+		nodes += _search.bestMove(_pos, _game, limits);
+		_search.printStats();
+	}
+
+	_search.setCollectStats(false);
+	timer.stop();
+	const auto duration_ms = std::max<decltype(timer.duration())>(timer.duration(), 1);
+
+	std::cout << "bench nodes " << nodes << " time " << duration_ms 
+		<< " nps " << nodes * 1000 / duration_ms << '\n';
+}
+
+// codecbench [positions <n, default 1000000>] [file <FEN or EPD file>]
+// speed of reading and writing FEN and of packing positions into 32 bytes and back, in positions per second.
+// Positions come from the file, or from bench, and from random games played from them.
+void UniversalChessInterface::parseCodecBench(std::istringstream& strm) {
+	std::string token, value;
+	size_t conversions = 1000000;
+	std::vector<std::string> fens(bench_fens.begin(), bench_fens.end());
+
+	while (strm >> std::skipws >> token >> value) {
+		if (token == "positions" and isValidNumber(value) and !value.empty())
+			conversions = std::stoull(value);
+		else if (token == "file") {
+			std::ifstream file(value);
+
+			if (!file) {
+				std::cout << "info string can't open " << value << '\n';
+				return;
+			}
+
+			fens.clear();
+
+			for (std::string line; std::getline(file, line); )
+				fens.push_back(std::move(line));
+		}
+	}
+
+	Fen::benchmark(fens, conversions);
+}
+
+// makebook <pgn file> <book file> [depth <plies, default 20>] [mingames <n, default 3>] [threads <n, default 1>]
+void UniversalChessInterface::parseMakeBook(std::istringstream& strm) {
+	std::string pgn_path, book_path, token;
+	BookBuilder::Settings settings;
+
+	if (!(strm >> std::skipws >> pgn_path >> book_path)) {
+		std::cout << "info string makebook needs PGN and book file\n";
+		return;
+	}
+
+	while (strm >> std::skipws >> token) {
+		std::string value;
+		strm >> std::skipws >> value;
+
+		if (!isValidNumber(value) or value.empty())
+			continue;
+
+		if (token == "depth")
+			settings.depth = std::stoi(value);
+		else if (token == "mingames")
+			settings.min_games = std::stoi(value);
+		else if (token == "threads")
+			settings.threads = std::max(std::stoi(value), 1);
+	}
+
+	BookBuilder builder;
+	Timer timer;
+
+	timer.go();
+	const bool built = builder.build(pgn_path, book_path, settings);
+	timer.stop();
+
+	if (!built) {
+		std::cout << "info string can't build book " << book_path << " from " << pgn_path << '\n';
+		return;
+	}
+
+	const auto& stats = builder.getStats();
+	const auto duration_ms = std::max<decltype(timer.duration())>(timer.duration(), 1);
+
+	std::cout << "info string book " << book_path << " built, " 
+		<< stats.games << " games, " << stats.skipped_games << " skipped, "
+		<< stats.positions << " positions, " << stats.entries << " entries, "
+		<< duration_ms << " ms, " << stats.games * 1000 / duration_ms << " games/s\n";
+}
+
+// makebitbase <material, e.g. KRvKP> <bitbase file> [threads n]
+// file with .cpp extension gets C++ definition of the bits instead of a binary bitbase
+void UniversalChessInterface::parseMakeBitbase(std::istringstream& strm) {
+	std::string code, path, token;
+	BitbaseGenerator::Settings settings;
+
+	if (!(strm >> std::skipws >> code >> path)) {
+		std::cout << "info string makebitbase needs material and bitbase file\n";
+		return;
+	}
+
+	while (strm >> std::skipws >> token) {
+		std::string value;
+		strm >> std::skipws >> value;
+
+		if (token == "threads" and isValidNumber(value) and !value.empty())
+			settings.threads = std::max(std::stoi(value), 1);
+	}
+
+	BitbaseGenerator generator;
+	Timer timer;
+
+	timer.go();
+
+	if (!generator.generate(code, settings)) {
+		std::cout << "info string invalid material " << code << ", up to " << Bitbase::max_pieces << " pieces allowed\n";
+		return;
+	}
+
+	timer.stop();
+
+	const auto& table = generator.getTable();
+	const bool saved = path.ends_with(".cpp") ? table.saveSource(path) : table.save(path);
+
+	if (!saved) {
+		std::cout << "info string can't write bitbase " << path << '\n';
+		return;
+	}
+
+	const auto& stats = generator.getStats();
+	const auto duration_ms = std::max<decltype(timer.duration())>(timer.duration(), 1);
+
+	std::cout << "info string bitbase " << table.code() << " built, "
+		<< stats.tables << " tables, " << stats.positions << " positions, " << stats.wins << " wins, "
+		<< stats.passes << " passes, " << duration_ms << " ms, " << stats.positions * 1000 / duration_ms << " positions/s\n";
+}
+
+// analyze <EPD file> <output file> [depth n] [nodes n] [movetime ms] [threads n] [hash MB, default 16] [sharedhash true|false]
+// limits are set for each position, depth 10 is searched when none is given
+void UniversalChessInterface::parseAnalyze(std::istringstream& strm) {
+	std::string epd_path, out_path, token;
+	Analyzer::Settings settings;
+
+	if (!(strm >> std::skipws >> epd_path >> out_path)) {
+		std::cout << "info string analyze needs EPD and output file\n";
+		return;
+	}
+
+	while (strm >> std::skipws >> token) {
+		std::string value;
+		strm >> std::skipws >> value;
+
+		if (token == "sharedhash") {
+			settings.shared_hash = value != "false";
+			continue;
+		}
+
+		if (!isValidNumber(value) or value.empty())
+			continue;
+
+		if (token == "depth")
+			settings.depth = std::stoi(value);
+		else if (token == "nodes")
+			settings.nodes = std::stoull(value);
+		else if (token == "movetime")
+			settings.movetime = std::stoi(value);
+		else if (token == "threads")
+			settings.threads = std::max(std::stoi(value), 1);
+		else if (token == "hash")
+			settings.hash_mb = std::max(std::stoi(value), 1);
+	}
+
+	Analyzer analyzer;
+	Timer timer;
+
+	timer.go();
+	const bool analyzed = analyzer.run(epd_path, out_path, settings);
+	timer.stop();
+
+	if (!analyzed) {
+		std::cout << "info string can't analyze " << epd_path << " into " << out_path << '\n';
+		return;
+	}
+
+	const auto& stats = analyzer.getStats();
+	const auto duration_ms = std::max<decltype(timer.duration())>(timer.duration(), 1);
+
+	std::cout << "info string analyzed " << stats.positions << " positions, " << stats.skipped << " skipped, "
+		<< stats.nodes << " nodes, " << duration_ms << " ms, "
+		<< stats.positions * 1000.f / duration_ms << " positions/s, " << stats.nodes * 1000 / duration_ms << " nps\n";
+}
+
+// testsuite <EPD file> [movetime ms] [nodes n] [depth n] [threads n] [hash MB, default 16]
+// positions need bm or am operations, 1000 ms is given to each position when there is no limit
+void UniversalChessInterface::parseTestSuite(std::istringstream& strm) {
+	std::string epd_path, token;
+	TestSuite::Settings settings;
+
+	if (!(strm >> std::skipws >> epd_path)) {
+		std::cout << "info string testsuite needs EPD file\n";
+		return;
+	}
+
+	while (strm >> std::skipws >> token) {
+		std::string value;
+		strm >> std::skipws >> value;
+
+		if (!isValidNumber(value) or value.empty())
+			continue;
+
+		if (token == "movetime")
+			settings.movetime = std::stoi(value);
+		else if (token == "nodes")
+			settings.nodes = std::stoull(value);
+		else if (token == "depth")
+			settings.depth = std::stoi(value);
+		else if (token == "threads")
+			settings.threads = std::max(std::stoi(value), 1);
+		else if (token == "hash")
+			settings.hash_mb = std::max(std::stoi(value), 1);
+	}
+
+	TestSuite suite;
+	Timer timer;
+
+	timer.go();
+	const bool completed = suite.run(epd_path, settings);
+	timer.stop();
+
+	if (!completed) {
+		std::cout << "info string can't read test suite " << epd_path << '\n';
+		return;
+	}
+
+	for (const auto& result : suite.getResults()) {
+		if (result.solved)
+			continue;
+
+		std::cout << "info string failed " << result.id << " best move ";
+		result.best_move.print();
+		std::cout << '\n';
+	}
+
+	const auto& stats = suite.getStats();
+	const auto duration_ms = std::max<decltype(timer.duration())>(timer.duration(), 1);
+
+	std::cout << "info string solved " << stats.solved << '/' << stats.positions << ", " << stats.skipped << " skipped, "
+		<< stats.nodes << " nodes, " << duration_ms << " ms\n"
+		<< "info string time to solve p50 " << suite.timePercentile(50) << " p90 " << suite.timePercentile(90)
+		<< " max " << suite.timePercentile(100) << " ms, nodes to solve p50 " << suite.nodesPercentile(50)
+		<< " p90 " << suite.nodesPercentile(90) << " max " << suite.nodesPercentile(100) << '\n';
+}
+
+// match [games n, default 4000] [concurrency n] [tc <base s>+<inc s>, default 1+0.04] [nodes n] [openings <EPD file>]
+//       [hash1 MB] [hash2 MB] [evalcache1 MB] [evalcache2 MB] [probedepth1 n] [probedepth2 n]
+//       [elo0 x, default 0] [elo1 x, default 5] [alpha x] [beta x]
+// games between two differently set up searches, options ending with 1 and 2 are of the first and the second side
+void UniversalChessInterface::parseMatch(std::istringstream& strm) {
+	std::string token, value;
+	Match::Settings settings;
+
+	while (strm >> std::skipws >> token >> value) {
+		double number;
+
+		if (token == "openings")
+			settings.openings = value;
+		else if (token == "tc") {
+			const size_t plus = value.find('+');
+			double base, inc = 0;
+
+			if (parseDecimal(value.substr(0, plus), base) and (plus == std::string::npos or parseDecimal(value.substr(plus + 1), inc))) {
+				settings.base_ms = static_cast<unsigned>(std::max(base, 0.0) * 1000);
+				settings.inc_ms = static_cast<unsigned>(std::max(inc, 0.0) * 1000);
+			}
+		}
+		else if (!parseDecimal(value, number))
+			continue;
+		else if (token == "elo0")
+			settings.elo0 = number;
+		else if (token == "elo1")
+			settings.elo1 = number;
+		else if (token == "alpha" and 0 < number and number < 1)
+			settings.alpha = number;
+		else if (token == "beta" and 0 < number and number < 1)
+			settings.beta = number;
+		else if (number < 0)
+			continue;
+		else if (token == "games")
+			settings.games = static_cast<unsigned>(number);
+		else if (token == "concurrency")
+			settings.concurrency = std::max(static_cast<unsigned>(number), 1U);
+		else if (token == "nodes")
+			settings.nodes = static_cast<uint64_t>(number);
+		else if (token == "hash1" or token == "hash2")
+			settings.sides[token.back() - '1'].hash_mb = std::max(static_cast<size_t>(number), size_t(1));
+		else if (token == "evalcache1" or token == "evalcache2")
+			settings.sides[token.back() - '1'].eval_cache_mb = std::min(static_cast<size_t>(number), size_t(1024));
+		else if (token == "probedepth1" or token == "probedepth2")
+			settings.sides[token.back() - '1'].tb_probe_depth = std::clamp(static_cast<unsigned>(number), 1U, 100U);
+	}
+
+	Match match;
+	Timer timer;
+
+	timer.go();
+
+	if (!match.run(settings)) {
+		std::cout << "info string can't read openings " << settings.openings << '\n';
+		return;
+	}
+
+	timer.stop();
+
+	const auto& stats = match.getStats();
+
+	std::cout << "info string match finished, " << stats.games() << " games, "
+		<< stats.toStr(settings.elo0, settings.elo1) << ", " << timer.duration() << " ms\n";
+}
+
+// datagen <output file> [positions n, default 1000000] [threads n] [nodes <per move, default 5000>]
+//         [randomplies n, default 8] [book <Polyglot file>] [seed n] [hash MB, default 16]
+// self-play games, quiet positions are written as 32-byte records labelled with score and game result
+void UniversalChessInterface::parseDatagen(std::istringstream& strm) {
+	std::string path, token;
+	DataGenerator::Settings settings;
+
+	if (!(strm >> std::skipws >> path)) {
+		std::cout << "info string datagen needs output file\n";
+		return;
+	}
+
+	while (strm >> std::skipws >> token) {
+		std::string value;
+		strm >> std::skipws >> value;
+
+		if (token == "book") {
+			settings.book = value;
+			continue;
+		}
+
+		if (!isValidNumber(value) or value.empty())
+			continue;
+
+		if (token == "positions")
+			settings.positions = std::stoull(value);
+		else if (token == "threads")
+			settings.threads = std::max(std::stoi(value), 1);
+		else if (token == "nodes")
+			settings.nodes = std::max(std::stoull(value), 1ULL);
+		else if (token == "randomplies")
+			settings.random_plies = std::stoi(value);
+		else if (token == "seed")
+			settings.seed = std::stoull(value);
+		else if (token == "hash")
+			settings.hash_mb = std::max(std::stoi(value), 1);
+	}
+
+	DataGenerator generator;
+	Timer timer;
+
+	timer.go();
+	const bool generated = generator.generate(path, settings);
+	timer.stop();
+
+	if (!generated) {
+		std::cout << "info string can't generate data into " << path << (settings.book.empty() ? "" : " with book " + settings.book) << '\n';
+		return;
+	}
+
+	const auto& stats = generator.getStats();
+	const auto duration_ms = std::max<decltype(timer.duration())>(timer.duration(), 1);
+	const uint64_t positions_per_s = stats.positions * 1000 / duration_ms;
+
+	std::cout << "info string data generated, " << stats.games << " games, " << stats.positions << " positions, "
+		<< stats.nodes << " nodes, " << duration_ms << " ms, " << positions_per_s << " positions/s, "
+		<< positions_per_s / settings.threads << " positions/s per thread\n";
+}
+
+// tune <data file> <output file> [epochs n, default 100] [threads n] [batch n, default 16384] [lr x, default 0.5]
+//      [lambda x, default 0] [k x] [seed n]
+// Texel tuning of material values and PeSTO tables, data is either datagen output with .bin extension
+// or FEN/EPD lines labelled with results. Tuned tables are written as C++ arrays to replace those in Eval.cpp.
+void UniversalChessInterface::parseTune(std::istringstream& strm) {
+	std::string data_path, out_path, token, value;
+	Tuner::Settings settings;
+
+	if (!(strm >> std::skipws >> data_path >> out_path)) {
+		std::cout << "info string tune needs data file and output file\n";
+		return;
+	}
+
+	while (strm >> std::skipws >> token >> value) {
+		double number;
+
+		if (!parseDecimal(value, number) or number < 0)
+			continue;
+
+		if (token == "epochs")
+			settings.epochs = static_cast<unsigned>(number);
+		else if (token == "threads")
+			settings.threads = std::max(static_cast<unsigned>(number), 1U);
+		else if (token == "batch")
+			settings.batch_size = std::max(static_cast<size_t>(number), size_t(1));
+		else if (token == "lr" and number > 0)
+			settings.learning_rate = number;
+		else if (token == "lambda" and number <= 1)
+			settings.lambda = number;
+		else if (token == "k")
+			settings.k = number;
+		else if (token == "seed")
+			settings.seed = static_cast<uint64_t>(number);
+	}
+
+	Tuner tuner;
+	Timer timer;
+
+	timer.go();
+
+	if (!tuner.load(data_path, settings.threads)) {
+		std::cout << "info string can't read data " << data_path << '\n';
+		return;
+	}
+
+	timer.stop();
+
+	std::cout << "info string loaded " << tuner.getStats().positions << " positions, " << tuner.getStats().skipped
+		<< " skipped, " << timer.duration() << " ms\n";
+
+	timer.go();
+
+	if (!tuner.tune(out_path, settings)) {
+		std::cout << "info string can't tune " << (tuner.getStats().positions ? "into " + out_path : "without positions") << '\n';
+		return;
+	}
+
+	timer.stop();
+
+	const auto& stats = tuner.getStats();
+
+	std::cout << "info string tuning finished, loss " << stats.initial_loss << " -> " << stats.loss
+		<< ", tables written to " << out_path << ", " << timer.duration() << " ms\n";
+}
+
+// attackbench [pressure in MB, default 64]
+void UniversalChessInterface::parseAttackBench(std::istringstream& strm) {
+	std::string token;
+	size_t pressure_mb = 64;
+
+	if (strm >> std::skipws >> token and isValidNumber(token) and !token.empty())
+		pressure_mb = std::stoi(token);
+
+	SlidersMagics::benchmark(pressure_mb);
+}
@@ -2,8 +2,19 @@
 
 #include "../backend/Position.hpp"
 #include "../backend/Search.hpp"
+#include "../backend/MateSearch.hpp"
 #include "../backend/Game.hpp"
 #include "../backend/TranspositionTable.hpp"
+#include "../backend/Book.hpp"
+#include "../backend/BookBuilder.hpp"
+#include "../backend/Syzygy.hpp"
+#include "../backend/BitbaseGenerator.hpp"
+#include "../backend/Analyzer.hpp"
+#include "../backend/TestSuite.hpp"
+#include "../backend/Match.hpp"
+#include "../backend/DataGenerator.hpp"
+#include "../backend/Tuner.hpp"
+#include "../backend/Fen.hpp"
 
 class UniversalChessInterface {
 public:
@@ -17,10 +28,24 @@ private:
 	void parsePosition(std::istringstream& strm);
 	void parseGo(std::istringstream& strm);
 	void parseIsReady();
+	void parseSetOption(std::istringstream& strm);
+	void parseAttackBench(std::istringstream& strm);
+	void parseBench(std::istringstream& strm);
+	void parseCodecBench(std::istringstream& strm);
+	void parseMakeBook(std::istringstream& strm);
+	void parseMakeBitbase(std::istringstream& strm);
+	void parseAnalyze(std::istringstream& strm);
+	void parseTestSuite(std::istringstream& strm);
+	void parseMatch(std::istringstream& strm);
+	void parseDatagen(std::istringstream& strm);
+	void parseTune(std::istringstream& strm);
 
 	Position _pos;
 	Search _search;
+	MateSearch _mate_search;
 	Game _game;
+	Book _book;
+	bool _own_book = false;
 
 	std::string _command;
 